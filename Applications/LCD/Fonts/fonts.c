@@ -294,8 +294,173 @@ static const uint16_t font_large [] = {
 0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3F07,0x7FC7,0x73E7,0xF1FF,0xF07E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [~]
 };
 
+// Generated Source Code Pro Bold 25, 4 bpp coverage, 16x26
+static const uint8_t font_large_aa [] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [ ]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xBE,0xB2,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x02,0xBE,0xB2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [!]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0x50,0x4F,0xFF,0xE0,0x00,0x00,0xDF,0xFF,0x40,0x4F,0xFF,0xE0,0x00,0x00,0xDF,0xFF,0x40,0x3F,0xFF,0xD0,0x00,0x00,0xCF,0xFF,0x30,0x3F,0xFF,0xD0,0x00,0x00,0xBF,0xFF,0x20,0x1F,0xFF,0xB0,0x00,0x00,0x8F,0xFE,0x00,0x0E,0xFF,0x90,0x00,0x00,0x6F,0xFC,0x00,0x0C,0xFF,0x70,0x00,0x00,0x4F,0xFA,0x00,0x0A,0xFF,0x50,0x00,0x00,0x2F,0xF8,0x00,0x08,0xFF,0x20,0x00,0x00,0x0F,0xF6,0x00,0x06,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = ["]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xF1,0x04,0xFC,0x00,0x00,0x00,0x00,0x2F,0xE0,0x06,0xFA,0x00,0x00,0x00,0x00,0x4F,0xD0,0x08,0xF8,0x00,0x00,0x00,0x00,0x6F,0xB0,0x0A,0xF7,0x00,0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0xDF,0x40,0x2F,0xF0,0x00,0x00,0x00,0x01,0xFF,0x20,0x5F,0xC0,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,0x00,0x07,0xFA,0x00,0xBF,0x60,0x00,0x00,0x00,0x09,0xF8,0x00,0xDF,0x40,0x00,0x00,0x00,0x0B,0xF6,0x00,0xFF,0x20,0x00,0x00,0x00,0x0D,0xF4,0x02,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [#]
+0x00,0x00,0x00,0x9F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xC0,0x00,0x00,0x00,0x00,0x00,0x5B,0xFF,0xFD,0x81,0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFE,0x30,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0xAF,0xFE,0x30,0x26,0xDA,0x00,0x00,0x00,0xAF,0xFE,0x10,0x00,0x10,0x00,0x00,0x00,0x7F,0xFF,0xE8,0x20,0x00,0x00,0x00,0x00,0x1D,0xFF,0xFF,0xFB,0x30,0x00,0x00,0x00,0x02,0xBF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x04,0xBF,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x02,0x9F,0xFF,0xE0,0x00,0x00,0x05,0x00,0x00,0x08,0xFF,0xF1,0x00,0x00,0x7F,0xD6,0x20,0x2B,0xFF,0xE0,0x00,0x02,0xEF,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x01,0x9F,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x03,0x9D,0xFF,0xFB,0x60,0x00,0x00,0x00,0x00,0x00,0x9F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [$]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xFC,0x40,0x00,0x00,0xA4,0x00,0x09,0xFF,0xFF,0xF4,0x00,0x07,0xFF,0x40,0x2F,0xFF,0xFF,0xFC,0x00,0x5F,0xFC,0x10,0x5F,0xF5,0x1A,0xFF,0x03,0xEF,0xB1,0x00,0x5F,0xF6,0x1A,0xFF,0x1D,0xFB,0x00,0x00,0x2F,0xFF,0xFF,0xFB,0x1B,0xA0,0x00,0x00,0x09,0xFF,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x7D,0xFC,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0xFD,0x70,0x00,0x00,0x00,0x9B,0x13,0xFF,0xFF,0xF9,0x00,0x00,0x0A,0xFD,0x1C,0xFF,0xFF,0xFF,0x20,0x01,0xBF,0xF3,0x0E,0xFA,0x15,0xFF,0x60,0x1B,0xFF,0x50,0x0E,0xFA,0x15,0xFF,0x50,0x3E,0xF8,0x00,0x0B,0xFF,0xFF,0xFF,0x20,0x04,0xA0,0x00,0x03,0xFF,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x3C,0xFE,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [%]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9E,0xFC,0x50,0x00,0x00,0x00,0x00,0x1D,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x8F,0xF8,0x1E,0xFD,0x00,0x00,0x00,0x00,0xCF,0xF3,0x0C,0xFF,0x10,0x00,0x00,0x00,0xCF,0xF4,0x2F,0xFF,0x10,0x00,0x00,0x00,0x9F,0xFA,0xDF,0xFB,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xF3,0x03,0x55,0x30,0x00,0x2E,0xFF,0xFF,0x60,0x0E,0xFF,0x60,0x02,0xEF,0xFF,0xF6,0x00,0x3F,0xFF,0x10,0x0C,0xFF,0xFF,0xFD,0x40,0xAF,0xFB,0x00,0x4F,0xFF,0x5A,0xFF,0xFC,0xFF,0xF3,0x00,0x6F,0xFF,0x20,0xAF,0xFF,0xFF,0xB0,0x00,0x5F,0xFF,0xA2,0x1A,0xFF,0xFF,0xC5,0x10,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x04,0xEF,0xFF,0xFF,0xFF,0xBF,0xFF,0x30,0x00,0x29,0xDF,0xEC,0x82,0x03,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [&]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [']
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xE2,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x40,0x00,0x00,0x00,0x00,0x00,0xBF,0xF8,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x3F,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xD2,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [(]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x02,0xEF,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x01,0xEF,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x2F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xF4,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x30,0x00,0x00,0x00,0x00,0x02,0xDF,0xF7,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [)]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x90,0x00,0x00,0x00,0x00,0x10,0x00,0xAF,0xA0,0x00,0x10,0x00,0x01,0xFD,0x95,0xCF,0xC5,0x9D,0xF1,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x4C,0xFF,0xFF,0xFF,0xFC,0x40,0x00,0x00,0x00,0x5D,0xFF,0xFD,0x50,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x9F,0xFB,0xFF,0x90,0x00,0x00,0x00,0x03,0xFF,0xA0,0xAF,0xF3,0x00,0x00,0x00,0x0B,0xFC,0x00,0x0C,0xFB,0x00,0x00,0x00,0x04,0xC2,0x00,0x02,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [*]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xD0,0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x00,0x00,0xDF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [+]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xBE,0xD5,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x03,0xCF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x8F,0xFD,0x00,0x00,0x00,0x00,0x00,0x3D,0xFF,0xE3,0x00,0x00,0x00,0x00,0x00,0x1E,0xFC,0x20,0x00,0x00,0x00,0x00,0x00,0x06,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [,]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [-]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xCE,0xC3,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x03,0xCE,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [.]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x4F,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xF7,0x00,0x00,0x00,0x00,0x00,0x01,0xEF,0xF2,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x2F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF3,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x5F,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xF5,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x3F,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [/]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0xEF,0xEA,0x30,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0xCF,0xFD,0x41,0x4D,0xFF,0xC0,0x00,0x02,0xFF,0xF4,0x00,0x04,0xFF,0xF2,0x00,0x05,0xFF,0xE0,0x00,0x00,0xEF,0xF5,0x00,0x08,0xFF,0xB0,0xAE,0xA0,0xBF,0xF8,0x00,0x09,0xFF,0xA4,0xFF,0xF4,0xAF,0xF8,0x00,0x08,0xFF,0xA4,0xFF,0xF4,0xBF,0xF8,0x00,0x07,0xFF,0xC0,0xAE,0xA0,0xCF,0xF7,0x00,0x05,0xFF,0xE0,0x00,0x00,0xEF,0xF5,0x00,0x02,0xFF,0xF5,0x00,0x05,0xFF,0xF2,0x00,0x00,0xBF,0xFD,0x41,0x4D,0xFF,0xB0,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x3A,0xEF,0xEA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [0]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x7A,0xDF,0xFC,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0xFC,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0xFC,0x00,0x00,0x00,0x00,0x1B,0xBB,0xEF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [1]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x8D,0xEE,0xC8,0x10,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xD2,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFD,0x00,0x00,0x01,0xCF,0xA3,0x03,0xBF,0xFF,0x40,0x00,0x00,0x16,0x00,0x00,0x1F,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x40,0x00,0x00,0x00,0x00,0x00,0xCF,0xFC,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x60,0x00,0x00,0x00,0x00,0x08,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0x80,0x00,0x00,0x00,0x00,0x1B,0xFF,0xF7,0x00,0x00,0x00,0x00,0x02,0xCF,0xFF,0xFD,0xEF,0xFF,0xF6,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [2]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x9D,0xEF,0xDA,0x40,0x00,0x00,0x01,0x9F,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x6F,0xA3,0x01,0x7F,0xFF,0xA0,0x00,0x00,0x03,0x00,0x00,0x0F,0xFF,0xA0,0x00,0x00,0x00,0x00,0x14,0xBF,0xFF,0x40,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xE5,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFE,0x50,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFB,0x10,0x00,0x00,0x00,0x00,0x14,0x9F,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xF3,0x00,0x00,0x42,0x00,0x00,0x08,0xFF,0xF4,0x00,0x02,0xEF,0x82,0x01,0x6E,0xFF,0xF1,0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x03,0xDF,0xFF,0xFF,0xFF,0xFA,0x10,0x00,0x00,0x06,0xAD,0xEF,0xDA,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [3]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xFE,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x1E,0xFF,0x9F,0xFE,0x00,0x00,0x00,0x00,0xBF,0xF9,0x6F,0xFE,0x00,0x00,0x00,0x06,0xFF,0xD1,0x7F,0xFE,0x00,0x00,0x00,0x3F,0xFF,0x30,0x7F,0xFE,0x00,0x00,0x00,0xCF,0xF7,0x00,0x7F,0xFE,0x00,0x00,0x09,0xFF,0xC0,0x00,0x7F,0xFE,0x00,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [4]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x5F,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xEC,0x71,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFD,0x20,0x00,0x00,0x3E,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x04,0x82,0x01,0x6E,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF4,0x00,0x00,0x32,0x00,0x00,0x08,0xFF,0xF3,0x00,0x01,0xDE,0x72,0x02,0x6E,0xFF,0xE0,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x02,0xCF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x00,0x05,0xAD,0xEF,0xD9,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [5]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xBE,0xFD,0xA5,0x00,0x00,0x00,0x01,0xBF,0xFF,0xFF,0xFF,0xB1,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0x6F,0xFF,0xB3,0x12,0x8D,0x20,0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF1,0x6C,0xEE,0xB4,0x00,0x00,0x07,0xFF,0xEB,0xFF,0xFF,0xFF,0x70,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x06,0xFF,0xFE,0x61,0x17,0xFF,0xF7,0x00,0x04,0xFF,0xF4,0x00,0x00,0xCF,0xF9,0x00,0x01,0xFF,0xF5,0x00,0x00,0xDF,0xF8,0x00,0x00,0xAF,0xFE,0x51,0x18,0xFF,0xF5,0x00,0x00,0x2E,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x03,0xEF,0xFF,0xFF,0xFD,0x20,0x00,0x00,0x00,0x18,0xCE,0xEC,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [6]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x8F,0xF9,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x5F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xF9,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [7]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0xEF,0xEB,0x50,0x00,0x00,0x00,0x0A,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0x50,0x00,0x00,0xBF,0xFD,0x30,0x3C,0xFF,0xA0,0x00,0x00,0xBF,0xF7,0x00,0x04,0xFF,0xB0,0x00,0x00,0x8F,0xFB,0x00,0x05,0xFF,0x90,0x00,0x00,0x1D,0xFF,0xD6,0x2D,0xFE,0x20,0x00,0x00,0x02,0xDF,0xFF,0xFF,0xE4,0x00,0x00,0x00,0x06,0xEF,0xFF,0xFF,0xD5,0x00,0x00,0x00,0x8F,0xFA,0x26,0xCF,0xFF,0x80,0x00,0x03,0xFF,0xD0,0x00,0x05,0xFF,0xF3,0x00,0x06,0xFF,0xC0,0x00,0x00,0xFF,0xF6,0x00,0x06,0xFF,0xF9,0x20,0x29,0xFF,0xF6,0x00,0x01,0xEF,0xFF,0xFF,0xFF,0xFF,0xE2,0x00,0x00,0x4E,0xFF,0xFF,0xFF,0xFE,0x50,0x00,0x00,0x02,0x8C,0xEF,0xEC,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [8]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x7C,0xEE,0xC7,0x10,0x00,0x00,0x00,0x2D,0xFF,0xFF,0xFF,0xE3,0x00,0x00,0x00,0xDF,0xFF,0xFF,0xFF,0xFE,0x10,0x00,0x06,0xFF,0xF8,0x11,0x5E,0xFF,0x90,0x00,0x09,0xFF,0xC0,0x00,0x05,0xFF,0xE0,0x00,0x0A,0xFF,0xB0,0x00,0x04,0xFF,0xF4,0x00,0x08,0xFF,0xF6,0x11,0x6E,0xFF,0xF6,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x8F,0xFF,0xFF,0xFA,0xFF,0xF6,0x00,0x00,0x05,0xBE,0xEB,0x51,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xC0,0x00,0x00,0x2D,0x72,0x13,0xBF,0xFF,0x50,0x00,0x01,0xDF,0xFF,0xFF,0xFF,0xFB,0x00,0x00,0x02,0xCF,0xFF,0xFF,0xFF,0xB1,0x00,0x00,0x00,0x05,0xAE,0xFE,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [9]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xCE,0xC3,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x03,0xCE,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xCE,0xC3,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x03,0xCE,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [:]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xCE,0xC3,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x03,0xCE,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xBE,0xD5,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x03,0xCF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x8F,0xFD,0x00,0x00,0x00,0x00,0x00,0x3D,0xFF,0xE3,0x00,0x00,0x00,0x00,0x00,0x1E,0xFC,0x20,0x00,0x00,0x00,0x00,0x00,0x06,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [;]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x70,0x00,0x00,0x00,0x00,0x00,0x02,0xBF,0x80,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0x80,0x00,0x00,0x00,0x00,0x4D,0xFF,0xFB,0x10,0x00,0x00,0x00,0x19,0xFF,0xFE,0x60,0x00,0x00,0x00,0x06,0xEF,0xFF,0xB2,0x00,0x00,0x00,0x00,0x1F,0xFF,0xE6,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xE6,0x00,0x00,0x00,0x00,0x00,0x06,0xEF,0xFF,0xB2,0x00,0x00,0x00,0x00,0x00,0x19,0xFF,0xFE,0x60,0x00,0x00,0x00,0x00,0x00,0x4D,0xFF,0xFA,0x10,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x02,0xBF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [<]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [=]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xB2,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFE,0x70,0x00,0x00,0x00,0x00,0x00,0x1B,0xFF,0xFD,0x40,0x00,0x00,0x00,0x00,0x00,0x6E,0xFF,0xF9,0x10,0x00,0x00,0x00,0x00,0x02,0xBF,0xFF,0xE6,0x00,0x00,0x00,0x00,0x00,0x06,0xEF,0xFF,0x10,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x10,0x00,0x00,0x00,0x00,0x06,0xEF,0xFF,0x10,0x00,0x00,0x00,0x02,0xBF,0xFF,0xE6,0x00,0x00,0x00,0x00,0x6E,0xFF,0xF9,0x10,0x00,0x00,0x00,0x1B,0xFF,0xFD,0x40,0x00,0x00,0x00,0x00,0x8F,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x8F,0xB2,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [>]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0xEF,0xDA,0x40,0x00,0x00,0x00,0x0A,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x04,0xE7,0x11,0x8F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0xAF,0xFD,0x00,0x00,0x00,0x00,0x00,0x1B,0xFF,0xD2,0x00,0x00,0x00,0x00,0x00,0xCF,0xFC,0x20,0x00,0x00,0x00,0x00,0x06,0xFF,0xE2,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xDE,0x90,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x05,0xDE,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [?]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xBE,0xFD,0x81,0x00,0x00,0x00,0x02,0xCF,0xFF,0xFF,0xFD,0x20,0x00,0x00,0x1D,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0xAF,0xFE,0x71,0x04,0xDF,0xF3,0x00,0x02,0xFF,0xE3,0x00,0x00,0x2F,0xF8,0x00,0x08,0xFF,0x60,0x00,0x00,0x0B,0xFA,0x00,0x0C,0xFE,0x00,0x00,0x00,0x08,0xFB,0x00,0x0F,0xFA,0x00,0x01,0x5A,0xDF,0xFB,0x00,0x2F,0xF7,0x00,0x4E,0xFF,0xFF,0xFB,0x00,0x3F,0xF5,0x03,0xFF,0xFF,0xFF,0xFB,0x00,0x3F,0xF5,0x09,0xFF,0x83,0x1E,0xFB,0x00,0x2F,0xF5,0x0B,0xFF,0x21,0x5F,0xFB,0x00,0x1F,0xF7,0x08,0xFF,0xFF,0xFF,0xFB,0x00,0x0E,0xFA,0x02,0xFF,0xFF,0xFA,0xFB,0x00,0x0B,0xFE,0x10,0x4C,0xFC,0x42,0x97,0x00,0x06,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x01,0xEF,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0x82,0x01,0x5B,0x20,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x01,0xAF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x04,0xAD,0xFD,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [@]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFD,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0xCF,0xFA,0xFF,0xC0,0x00,0x00,0x00,0x02,0xFF,0xE2,0xFF,0xF2,0x00,0x00,0x00,0x07,0xFF,0xB0,0xDF,0xF7,0x00,0x00,0x00,0x0C,0xFF,0x60,0x8F,0xFB,0x00,0x00,0x00,0x1F,0xFF,0x20,0x4F,0xFF,0x10,0x00,0x00,0x6F,0xFD,0x00,0x0E,0xFF,0x60,0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x0A,0xFF,0xD0,0x00,0x00,0xEF,0xFA,0x00,0x0E,0xFF,0x90,0x00,0x00,0xBF,0xFE,0x00,0x5F,0xFF,0x50,0x00,0x00,0x7F,0xFF,0x50,0x9F,0xFF,0x10,0x00,0x00,0x4F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [A]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xDC,0x92,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0x50,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0xEF,0xFC,0x00,0x3C,0xFF,0xF2,0x00,0x00,0xEF,0xFC,0x00,0x07,0xFF,0xF1,0x00,0x00,0xEF,0xFC,0x01,0x4D,0xFF,0xA0,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFA,0x10,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xC6,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xC1,0x00,0x00,0xEF,0xFC,0x00,0x27,0xFF,0xF9,0x00,0x00,0xEF,0xFC,0x00,0x00,0xBF,0xFC,0x00,0x00,0xEF,0xFC,0x00,0x00,0xCF,0xFD,0x00,0x00,0xEF,0xFC,0x00,0x28,0xFF,0xFB,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0xEF,0xFF,0xFF,0xED,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [B]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x8C,0xEE,0xD8,0x20,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xE6,0x00,0x00,0x0A,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x6F,0xFF,0xE6,0x11,0x4D,0x80,0x00,0x00,0xEF,0xFF,0x30,0x00,0x00,0x00,0x00,0x04,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x01,0xEF,0xFF,0x30,0x00,0x01,0x30,0x00,0x00,0x7F,0xFF,0xE6,0x10,0x4D,0xE2,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0xFD,0x10,0x00,0x01,0xAF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x03,0x9D,0xEE,0xD8,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [C]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFD,0xB6,0x10,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xE4,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x06,0xFF,0xF5,0x14,0xBF,0xFF,0xD0,0x00,0x06,0xFF,0xF5,0x00,0x0B,0xFF,0xF5,0x00,0x06,0xFF,0xF5,0x00,0x04,0xFF,0xFA,0x00,0x06,0xFF,0xF5,0x00,0x00,0xFF,0xFC,0x00,0x06,0xFF,0xF5,0x00,0x00,0xEF,0xFD,0x00,0x06,0xFF,0xF5,0x00,0x00,0xEF,0xFD,0x00,0x06,0xFF,0xF5,0x00,0x00,0xFF,0xFC,0x00,0x06,0xFF,0xF5,0x00,0x04,0xFF,0xF9,0x00,0x06,0xFF,0xF5,0x00,0x0C,0xFF,0xF5,0x00,0x06,0xFF,0xF5,0x14,0xBF,0xFF,0xD0,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xE4,0x00,0x00,0x06,0xFF,0xFF,0xFE,0xB6,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [D]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xF1,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xF1,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xF1,0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [E]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x4F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x4F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [F]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xAD,0xFE,0xB5,0x00,0x00,0x00,0x02,0xCF,0xFF,0xFF,0xFF,0xB1,0x00,0x00,0x2E,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0xBF,0xFF,0xC3,0x02,0x8D,0x20,0x00,0x03,0xFF,0xFD,0x10,0x00,0x00,0x00,0x00,0x08,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xE0,0x00,0xFF,0xFF,0xFA,0x00,0x0D,0xFF,0xE0,0x00,0xFF,0xFF,0xFA,0x00,0x0C,0xFF,0xF1,0x00,0xFF,0xFF,0xFA,0x00,0x09,0xFF,0xF4,0x00,0x00,0x9F,0xFA,0x00,0x05,0xFF,0xFB,0x00,0x00,0x9F,0xFA,0x00,0x00,0xCF,0xFF,0xB3,0x02,0xBF,0xFA,0x00,0x00,0x3E,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x03,0xDF,0xFF,0xFF,0xFF,0xD4,0x00,0x00,0x00,0x06,0xBE,0xFE,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [G]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [H]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [I]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xD0,0x00,0x00,0x08,0x10,0x00,0x0E,0xFF,0xC0,0x00,0x00,0x9F,0xD4,0x12,0x9F,0xFF,0x90,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x02,0x9D,0xFE,0xD9,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [J]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xF6,0x00,0x02,0xEF,0xFD,0x10,0x04,0xFF,0xF6,0x00,0x0B,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x8F,0xFF,0x70,0x00,0x04,0xFF,0xF6,0x04,0xFF,0xFA,0x00,0x00,0x04,0xFF,0xF6,0x1E,0xFF,0xD1,0x00,0x00,0x04,0xFF,0xF6,0xBF,0xFE,0x30,0x00,0x00,0x04,0xFF,0xFD,0xFF,0xFA,0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xA0,0x00,0x00,0x04,0xFF,0xFF,0xEA,0xFF,0xF4,0x00,0x00,0x04,0xFF,0xFF,0x61,0xEF,0xFC,0x00,0x00,0x04,0xFF,0xFA,0x00,0x8F,0xFF,0x50,0x00,0x04,0xFF,0xF6,0x00,0x1E,0xFF,0xD0,0x00,0x04,0xFF,0xF6,0x00,0x07,0xFF,0xF7,0x00,0x04,0xFF,0xF6,0x00,0x01,0xEF,0xFE,0x10,0x04,0xFF,0xF6,0x00,0x00,0x7F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [K]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [L]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xF7,0x00,0x07,0xFF,0xF6,0x00,0x06,0xFF,0xFB,0x00,0x0B,0xFF,0xF6,0x00,0x06,0xFF,0xFF,0x10,0x0E,0xFF,0xF6,0x00,0x06,0xFF,0xCF,0x50,0x4F,0xCF,0xF6,0x00,0x06,0xFF,0x9F,0x90,0x8F,0x9F,0xF6,0x00,0x06,0xFF,0x6F,0xD0,0xCF,0x6F,0xF6,0x00,0x06,0xFF,0x5C,0xF3,0xFB,0x6F,0xF6,0x00,0x06,0xFF,0x68,0xFA,0xF7,0x7F,0xF6,0x00,0x06,0xFF,0x73,0xFF,0xF2,0x8F,0xF6,0x00,0x06,0xFF,0x80,0xDF,0xC0,0x9F,0xF6,0x00,0x06,0xFF,0x80,0x8F,0x70,0x9F,0xF6,0x00,0x06,0xFF,0x80,0x00,0x00,0x9F,0xF6,0x00,0x06,0xFF,0x80,0x00,0x00,0x9F,0xF6,0x00,0x06,0xFF,0x80,0x00,0x00,0x9F,0xF6,0x00,0x06,0xFF,0x80,0x00,0x00,0x9F,0xF6,0x00,0x06,0xFF,0x80,0x00,0x00,0x9F,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [M]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF9,0x00,0x03,0xFF,0xF5,0x00,0x05,0xFF,0xFF,0x10,0x03,0xFF,0xF5,0x00,0x05,0xFF,0xFF,0x70,0x03,0xFF,0xF5,0x00,0x05,0xFF,0xFF,0xD0,0x03,0xFF,0xF5,0x00,0x05,0xFF,0xFF,0xF5,0x03,0xFF,0xF5,0x00,0x05,0xFF,0xCE,0xFC,0x02,0xFF,0xF5,0x00,0x05,0xFF,0xC8,0xFF,0x32,0xFF,0xF5,0x00,0x05,0xFF,0xE2,0xFF,0xA1,0xFF,0xF5,0x00,0x05,0xFF,0xF0,0xAF,0xF2,0xEF,0xF5,0x00,0x05,0xFF,0xF1,0x3F,0xF8,0xCF,0xF5,0x00,0x05,0xFF,0xF2,0x0C,0xFE,0xCF,0xF5,0x00,0x05,0xFF,0xF3,0x05,0xFF,0xFF,0xF5,0x00,0x05,0xFF,0xF3,0x00,0xDF,0xFF,0xF5,0x00,0x05,0xFF,0xF3,0x00,0x7F,0xFF,0xF5,0x00,0x05,0xFF,0xF3,0x00,0x1F,0xFF,0xF5,0x00,0x05,0xFF,0xF3,0x00,0x09,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [N]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xEF,0xEA,0x40,0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x02,0xFF,0xFE,0x41,0x4E,0xFF,0xF2,0x00,0x08,0xFF,0xF6,0x00,0x06,0xFF,0xF8,0x00,0x0C,0xFF,0xF1,0x00,0x01,0xFF,0xFC,0x00,0x0E,0xFF,0xC0,0x00,0x00,0xCF,0xFE,0x00,0x0F,0xFF,0xB0,0x00,0x00,0xBF,0xFF,0x00,0x0F,0xFF,0xC0,0x00,0x00,0xCF,0xFF,0x00,0x0E,0xFF,0xD0,0x00,0x00,0xDF,0xFE,0x00,0x0B,0xFF,0xF1,0x00,0x01,0xFF,0xFB,0x00,0x07,0xFF,0xF7,0x00,0x07,0xFF,0xF7,0x00,0x02,0xFF,0xFE,0x40,0x4E,0xFF,0xF1,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x4A,0xEF,0xEA,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [O]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xED,0xA4,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x02,0xFF,0xF8,0x00,0x16,0xFF,0xFD,0x00,0x02,0xFF,0xF8,0x00,0x00,0x9F,0xFF,0x10,0x02,0xFF,0xF8,0x00,0x00,0x7F,0xFF,0x20,0x02,0xFF,0xF8,0x00,0x00,0xAF,0xFF,0x10,0x02,0xFF,0xF8,0x00,0x28,0xFF,0xFC,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x02,0xFF,0xFF,0xFF,0xEC,0x92,0x00,0x00,0x02,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [P]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xEF,0xDA,0x30,0x00,0x00,0x00,0x0A,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x02,0xFF,0xFE,0x41,0x5F,0xFF,0xE1,0x00,0x08,0xFF,0xF5,0x00,0x07,0xFF,0xF6,0x00,0x0C,0xFF,0xE0,0x00,0x02,0xFF,0xF9,0x00,0x0F,0xFF,0xB0,0x00,0x00,0xEF,0xFC,0x00,0x1F,0xFF,0xA0,0x00,0x00,0xDF,0xFD,0x00,0x1F,0xFF,0xB0,0x00,0x00,0xDF,0xFD,0x00,0x0F,0xFF,0xC0,0x00,0x00,0xFF,0xFD,0x00,0x0D,0xFF,0xE1,0x00,0x03,0xFF,0xFA,0x00,0x09,0xFF,0xF5,0x00,0x08,0xFF,0xF7,0x00,0x04,0xFF,0xFE,0x40,0x5F,0xFF,0xF1,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x1C,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x01,0x8E,0xFF,0xFE,0x60,0x00,0x00,0x00,0x00,0x01,0xEF,0xFE,0x62,0x02,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x10,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x18,0xCE,0xEC,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [Q]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xEC,0x93,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x04,0xFF,0xF6,0x00,0x28,0xFF,0xFA,0x00,0x04,0xFF,0xF6,0x00,0x00,0xDF,0xFC,0x00,0x04,0xFF,0xF6,0x00,0x00,0xEF,0xFB,0x00,0x04,0xFF,0xF6,0x00,0x2A,0xFF,0xF8,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFE,0x40,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x04,0xFF,0xF6,0x06,0xFF,0xF8,0x00,0x00,0x04,0xFF,0xF6,0x00,0xDF,0xFF,0x20,0x00,0x04,0xFF,0xF6,0x00,0x5F,0xFF,0xA0,0x00,0x04,0xFF,0xF6,0x00,0x0C,0xFF,0xF3,0x00,0x04,0xFF,0xF6,0x00,0x05,0xFF,0xFB,0x00,0x04,0xFF,0xF6,0x00,0x00,0xCF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [R]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0xDF,0xEC,0x82,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0xEF,0xFE,0x41,0x14,0xBE,0x20,0x00,0x01,0xFF,0xFA,0x00,0x00,0x02,0x00,0x00,0x00,0xEF,0xFF,0x81,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xA4,0x00,0x00,0x00,0x00,0x1B,0xFF,0xFF,0xFF,0xD6,0x00,0x00,0x00,0x00,0x6D,0xFF,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x4A,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x19,0xFF,0xFA,0x00,0x00,0x07,0x10,0x00,0x01,0xFF,0xFB,0x00,0x00,0xAF,0xD7,0x20,0x28,0xFF,0xF8,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x00,0x01,0xAF,0xFF,0xFF,0xFF,0xFE,0x40,0x00,0x00,0x02,0x8C,0xEF,0xEB,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [S]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [T]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xF4,0x00,0x02,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x02,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x02,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x02,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x02,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x02,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x02,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x02,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x02,0xFF,0xF6,0x00,0x06,0xFF,0xF4,0x00,0x02,0xFF,0xF6,0x00,0x05,0xFF,0xF5,0x00,0x03,0xFF,0xF5,0x00,0x03,0xFF,0xF8,0x00,0x06,0xFF,0xF3,0x00,0x00,0xEF,0xFE,0x41,0x3D,0xFF,0xE1,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xFB,0x10,0x00,0x00,0x00,0x6B,0xEF,0xEB,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [U]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0x60,0x00,0x00,0x4F,0xFF,0x70,0x2F,0xFF,0xA0,0x00,0x00,0x8F,0xFF,0x20,0x0D,0xFF,0xE0,0x00,0x00,0xBF,0xFD,0x00,0x08,0xFF,0xF2,0x00,0x00,0xFF,0xF8,0x00,0x04,0xFF,0xF6,0x00,0x04,0xFF,0xF4,0x00,0x00,0xEF,0xFA,0x00,0x08,0xFF,0xE0,0x00,0x00,0x9F,0xFE,0x00,0x0B,0xFF,0x90,0x00,0x00,0x5F,0xFF,0x20,0x0F,0xFF,0x50,0x00,0x00,0x1F,0xFF,0x60,0x4F,0xFF,0x10,0x00,0x00,0x0B,0xFF,0xA0,0x7F,0xFB,0x00,0x00,0x00,0x06,0xFF,0xE0,0xBF,0xF6,0x00,0x00,0x00,0x01,0xFF,0xF3,0xFF,0xF2,0x00,0x00,0x00,0x00,0xCF,0xFA,0xFF,0xC0,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [V]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFD,0x00,0x00,0x00,0x09,0xFF,0xD0,0xBF,0xFE,0x00,0x00,0x00,0x0A,0xFF,0xB0,0x9F,0xFF,0x00,0x00,0x00,0x0B,0xFF,0x90,0x6F,0xFF,0x10,0x00,0x00,0x0C,0xFF,0x70,0x4F,0xFF,0x20,0x9F,0xD0,0x0D,0xFF,0x50,0x2F,0xFF,0x30,0xCF,0xF2,0x0E,0xFF,0x30,0x0F,0xFF,0x41,0xFF,0xF5,0x0E,0xFF,0x10,0x0D,0xFF,0x44,0xFC,0xF9,0x0F,0xFE,0x00,0x0B,0xFF,0x58,0xF9,0xFC,0x1F,0xFC,0x00,0x09,0xFF,0x6B,0xF5,0xFF,0x2F,0xFA,0x00,0x07,0xFF,0x6E,0xF1,0xFF,0x5F,0xF9,0x00,0x05,0xFF,0x9F,0xD0,0xCF,0x8F,0xF7,0x00,0x03,0xFF,0xCF,0xA0,0x9F,0xCF,0xF5,0x00,0x01,0xFF,0xFF,0x70,0x6F,0xFF,0xF3,0x00,0x00,0xEF,0xFF,0x50,0x4F,0xFF,0xF1,0x00,0x00,0xCF,0xFF,0x20,0x1F,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [W]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xF2,0x00,0x00,0xDF,0xFE,0x10,0x06,0xFF,0xF9,0x00,0x06,0xFF,0xF7,0x00,0x00,0xCF,0xFF,0x20,0x0D,0xFF,0xD0,0x00,0x00,0x4F,0xFF,0xA0,0x5F,0xFF,0x50,0x00,0x00,0x0A,0xFF,0xF2,0xCF,0xFB,0x00,0x00,0x00,0x02,0xFF,0xFC,0xFF,0xF3,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x06,0xFF,0xF9,0xFF,0xF4,0x00,0x00,0x00,0x1E,0xFF,0xA1,0xEF,0xFD,0x00,0x00,0x00,0x8F,0xFF,0x30,0x7F,0xFF,0x70,0x00,0x02,0xFF,0xFA,0x00,0x0D,0xFF,0xE2,0x00,0x0A,0xFF,0xF3,0x00,0x06,0xFF,0xFA,0x00,0x4F,0xFF,0xA0,0x00,0x00,0xCF,0xFF,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [X]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x80,0x00,0x00,0x7F,0xFF,0x50,0x0D,0xFF,0xE1,0x00,0x00,0xDF,0xFD,0x00,0x05,0xFF,0xF6,0x00,0x05,0xFF,0xF5,0x00,0x00,0xDF,0xFD,0x00,0x0B,0xFF,0xD0,0x00,0x00,0x5F,0xFF,0x40,0x3F,0xFF,0x50,0x00,0x00,0x0D,0xFF,0xA0,0x9F,0xFD,0x00,0x00,0x00,0x06,0xFF,0xF2,0xEF,0xF6,0x00,0x00,0x00,0x00,0xDF,0xFD,0xFF,0xD0,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFD,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [Y]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0xDF,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0xDF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xA0,0x00,0x00,0x00,0x00,0x01,0xEF,0xFD,0x10,0x00,0x00,0x00,0x00,0x0B,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0x80,0x00,0x00,0x00,0x00,0x02,0xEF,0xFC,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xE2,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x60,0x00,0x00,0x00,0x00,0x04,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x1D,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0x50,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [Z]
+0x00,0x00,0x0F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [[]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF3,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x01,0xEF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [\]
+0x00,0x6F,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = []]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x5F,0xFC,0xFF,0x50,0x00,0x00,0x00,0x00,0xBF,0xF3,0xFF,0xB0,0x00,0x00,0x00,0x02,0xFF,0xB0,0xBF,0xF2,0x00,0x00,0x00,0x07,0xFF,0x60,0x6F,0xF7,0x00,0x00,0x00,0x0D,0xFF,0x10,0x1F,0xFD,0x00,0x00,0x00,0x4F,0xFB,0x00,0x0B,0xFF,0x40,0x00,0x00,0xAF,0xF5,0x00,0x05,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [^]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [_]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xEF,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [`]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x7B,0xEF,0xEC,0x81,0x00,0x00,0x00,0x9E,0xFF,0xFF,0xFF,0xFD,0x20,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x1C,0x83,0x10,0x2A,0xFF,0xF2,0x00,0x00,0x00,0x26,0xAC,0xDF,0xFF,0xF5,0x00,0x00,0x2B,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x01,0xDF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x05,0xFF,0xFA,0x52,0x16,0xFF,0xF6,0x00,0x07,0xFF,0xF4,0x02,0x8F,0xFF,0xF6,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0xAF,0xFF,0xFF,0xFD,0xEF,0xF6,0x00,0x00,0x07,0xDF,0xEB,0x50,0xBF,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [a]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF6,0x6C,0xEE,0xB4,0x00,0x00,0x03,0xFF,0xFE,0xFF,0xFF,0xFF,0x60,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x00,0x03,0xFF,0xFF,0x61,0x2B,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xFB,0x00,0x03,0xFF,0xF7,0x00,0x00,0xFF,0xFC,0x00,0x03,0xFF,0xF7,0x00,0x00,0xFF,0xFC,0x00,0x03,0xFF,0xF9,0x00,0x04,0xFF,0xF9,0x00,0x03,0xFF,0xFF,0x61,0x3D,0xFF,0xF5,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x03,0xFF,0xEC,0xFF,0xFF,0xFD,0x20,0x00,0x03,0xFF,0xC0,0x7D,0xFD,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [b]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xAD,0xFE,0xC7,0x10,0x00,0x00,0x03,0xCF,0xFF,0xFF,0xFF,0xE3,0x00,0x00,0x2E,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0xBF,0xFF,0xC4,0x11,0x5C,0x30,0x00,0x02,0xFF,0xFD,0x10,0x00,0x00,0x00,0x00,0x04,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFD,0x10,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xC4,0x11,0x4C,0xA0,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x04,0xEF,0xFF,0xFF,0xFF,0xE4,0x00,0x00,0x00,0x17,0xBE,0xFE,0xB6,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [c]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x01,0x8D,0xFD,0x76,0xFF,0xF3,0x00,0x00,0x2D,0xFF,0xFF,0xFE,0xFF,0xF3,0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFF,0xF3,0x00,0x05,0xFF,0xFD,0x41,0x5E,0xFF,0xF3,0x00,0x0A,0xFF,0xF4,0x00,0x07,0xFF,0xF3,0x00,0x0C,0xFF,0xF0,0x00,0x07,0xFF,0xF3,0x00,0x0C,0xFF,0xF0,0x00,0x07,0xFF,0xF3,0x00,0x0A,0xFF,0xF3,0x00,0x08,0xFF,0xF3,0x00,0x07,0xFF,0xFC,0x31,0x6F,0xFF,0xF3,0x00,0x01,0xEF,0xFF,0xFF,0xFF,0xFF,0xF3,0x00,0x00,0x4F,0xFF,0xFF,0xFC,0xFF,0xF3,0x00,0x00,0x03,0xAE,0xFD,0x60,0xDF,0xF3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [d]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xDF,0xEC,0x71,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFD,0x20,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,0x01,0xFF,0xF9,0x31,0x13,0xDF,0xF5,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x06,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFE,0x72,0x01,0x4A,0x20,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xA0,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x28,0xCE,0xFD,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [e]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x8D,0xFE,0xD9,0x30,0x00,0x00,0x00,0x3E,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0xDF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x05,0xFF,0xFB,0x20,0x25,0x00,0x00,0x00,0x09,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF0,0x00,0x00,0x00,0x00,0xCE,0xEF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x00,0x0A,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [f]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x8C,0xEF,0xFF,0xFF,0xFF,0x30,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x01,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x02,0xFF,0xF9,0x21,0x5F,0xFE,0x10,0x00,0x00,0xDF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x2D,0xFF,0xFF,0xFF,0xFB,0x00,0x00,0x00,0x2E,0xFC,0xEF,0xDB,0x60,0x00,0x00,0x00,0xCF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xFF,0xFF,0xEC,0x70,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFB,0x00,0x00,0x6E,0xFE,0xFF,0xFF,0xFF,0xFF,0x30,0x05,0xFF,0x70,0x00,0x01,0x7F,0xFF,0x40,0x0A,0xFF,0xB3,0x10,0x14,0xBF,0xFF,0x10,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x02,0xDF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x17,0xBD,0xFF,0xEB,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [g]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF5,0x29,0xDF,0xD8,0x00,0x00,0x03,0xFF,0xFA,0xFF,0xFF,0xFF,0x90,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x03,0xFF,0xFF,0x91,0x1A,0xFF,0xF5,0x00,0x03,0xFF,0xFA,0x00,0x04,0xFF,0xF7,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [h]
+0x00,0x00,0x00,0x1A,0xEC,0x30,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x1B,0xEC,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [i]
+0x00,0x00,0x00,0x1A,0xEC,0x30,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x1B,0xEC,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x80,0x00,0x00,0x00,0x72,0x02,0xBF,0xFF,0x50,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xFE,0x10,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xE4,0x00,0x00,0x00,0x04,0xAD,0xEE,0xD9,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [j]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xF9,0x00,0x05,0xFF,0xFB,0x00,0x01,0xFF,0xF9,0x00,0x5F,0xFF,0xA0,0x00,0x01,0xFF,0xF9,0x06,0xFF,0xFA,0x00,0x00,0x01,0xFF,0xF9,0x6F,0xFF,0x90,0x00,0x00,0x01,0xFF,0xFD,0xFF,0xFC,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,0x00,0x01,0xFF,0xFF,0x93,0xFF,0xF8,0x00,0x00,0x01,0xFF,0xFA,0x00,0x8F,0xFF,0x40,0x00,0x01,0xFF,0xF9,0x00,0x1D,0xFF,0xD1,0x00,0x01,0xFF,0xF9,0x00,0x04,0xFF,0xF9,0x00,0x01,0xFF,0xF9,0x00,0x00,0xAF,0xFF,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [k]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF7,0x11,0x40,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xF1,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x07,0xDF,0xFD,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [l]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFB,0x3C,0xFC,0x33,0xCF,0xC3,0x00,0x1F,0xFE,0xDF,0xFF,0xCE,0xFF,0xFC,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x1F,0xFF,0xC1,0xEF,0xF8,0x4F,0xFF,0x40,0x1F,0xFF,0x60,0xCF,0xF2,0x2F,0xFF,0x50,0x1F,0xFF,0x50,0xCF,0xF0,0x2F,0xFF,0x50,0x1F,0xFF,0x50,0xCF,0xF0,0x2F,0xFF,0x50,0x1F,0xFF,0x50,0xCF,0xF0,0x2F,0xFF,0x50,0x1F,0xFF,0x50,0xCF,0xF0,0x2F,0xFF,0x50,0x1F,0xFF,0x50,0xCF,0xF0,0x2F,0xFF,0x50,0x1F,0xFF,0x50,0xCF,0xF0,0x2F,0xFF,0x50,0x1F,0xFF,0x50,0xCF,0xF0,0x2F,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [m]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xD0,0x2A,0xDF,0xD8,0x00,0x00,0x03,0xFF,0xF6,0xEF,0xFF,0xFF,0x90,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x03,0xFF,0xFF,0xA1,0x1A,0xFF,0xF5,0x00,0x03,0xFF,0xFB,0x00,0x04,0xFF,0xF7,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [n]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xEF,0xEA,0x40,0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFA,0x10,0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x04,0xFF,0xFD,0x31,0x3D,0xFF,0xF4,0x00,0x0A,0xFF,0xF4,0x00,0x04,0xFF,0xF9,0x00,0x0C,0xFF,0xF0,0x00,0x00,0xFF,0xFC,0x00,0x0C,0xFF,0xF0,0x00,0x00,0xFF,0xFC,0x00,0x0A,0xFF,0xF4,0x00,0x04,0xFF,0xF9,0x00,0x05,0xFF,0xFD,0x31,0x3D,0xFF,0xF4,0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x1B,0xFF,0xFF,0xFF,0xFB,0x10,0x00,0x00,0x00,0x5A,0xEF,0xEA,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [o]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xD0,0x5C,0xEE,0xB4,0x00,0x00,0x03,0xFF,0xFC,0xFF,0xFF,0xFF,0x60,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x00,0x03,0xFF,0xFF,0x71,0x2B,0xFF,0xF7,0x00,0x03,0xFF,0xF8,0x00,0x03,0xFF,0xFB,0x00,0x03,0xFF,0xF7,0x00,0x00,0xFF,0xFC,0x00,0x03,0xFF,0xF7,0x00,0x00,0xFF,0xFC,0x00,0x03,0xFF,0xF7,0x00,0x04,0xFF,0xF9,0x00,0x03,0xFF,0xFE,0x51,0x3D,0xFF,0xF5,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x03,0xFF,0xFE,0xFF,0xFF,0xFD,0x20,0x00,0x03,0xFF,0xF6,0x8D,0xFD,0x81,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [p]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8D,0xFD,0x81,0xCF,0xF3,0x00,0x00,0x2D,0xFF,0xFF,0xFD,0xFF,0xF3,0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFF,0xF3,0x00,0x05,0xFF,0xFD,0x41,0x6F,0xFF,0xF3,0x00,0x0A,0xFF,0xF4,0x00,0x08,0xFF,0xF3,0x00,0x0C,0xFF,0xF0,0x00,0x07,0xFF,0xF3,0x00,0x0C,0xFF,0xF0,0x00,0x07,0xFF,0xF3,0x00,0x0A,0xFF,0xF3,0x00,0x08,0xFF,0xF3,0x00,0x07,0xFF,0xFC,0x31,0x5E,0xFF,0xF3,0x00,0x01,0xEF,0xFF,0xFF,0xFF,0xFF,0xF3,0x00,0x00,0x4F,0xFF,0xFF,0xFE,0xFF,0xF3,0x00,0x00,0x03,0xAE,0xFD,0x66,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [q]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFE,0x00,0x5B,0xEF,0xD6,0x00,0x00,0x1F,0xFF,0x1A,0xFF,0xFF,0xF6,0x00,0x00,0x1F,0xFF,0xCF,0xFF,0xFF,0xF3,0x00,0x00,0x1F,0xFF,0xFF,0x93,0x11,0x30,0x00,0x00,0x1F,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [r]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xEF,0xEC,0x82,0x00,0x00,0x00,0x2D,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0xDF,0xFE,0x10,0x14,0xAE,0x10,0x00,0x00,0xAF,0xFF,0xD7,0x30,0x01,0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFE,0xA3,0x00,0x00,0x00,0x00,0x49,0xEF,0xFF,0xFF,0x80,0x00,0x00,0x13,0x00,0x03,0x8E,0xFF,0xF5,0x00,0x00,0xBF,0xA4,0x10,0x16,0xFF,0xF7,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x00,0x01,0x9F,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x02,0x7C,0xEF,0xEC,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [s]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0x00,0x00,0x00,0x00,0x0A,0xEE,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x0C,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x0C,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0x10,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xB2,0x01,0x41,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x5B,0xEF,0xEC,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [t]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF3,0x00,0x08,0xFF,0xF2,0x00,0x07,0xFF,0xF3,0x00,0x08,0xFF,0xF2,0x00,0x07,0xFF,0xF3,0x00,0x08,0xFF,0xF2,0x00,0x07,0xFF,0xF3,0x00,0x08,0xFF,0xF2,0x00,0x07,0xFF,0xF3,0x00,0x08,0xFF,0xF2,0x00,0x07,0xFF,0xF3,0x00,0x08,0xFF,0xF2,0x00,0x07,0xFF,0xF3,0x00,0x08,0xFF,0xF2,0x00,0x06,0xFF,0xF4,0x00,0x0C,0xFF,0xF2,0x00,0x05,0xFF,0xFB,0x11,0xAF,0xFF,0xF2,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x9F,0xFF,0xFF,0xE6,0xFF,0xF2,0x00,0x00,0x08,0xDF,0xE9,0x20,0xEF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [u]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xA0,0x00,0x00,0x7F,0xFF,0x10,0x0A,0xFF,0xE1,0x00,0x00,0xDF,0xFA,0x00,0x04,0xFF,0xF5,0x00,0x03,0xFF,0xF4,0x00,0x00,0xDF,0xFB,0x00,0x08,0xFF,0xD0,0x00,0x00,0x7F,0xFF,0x10,0x0E,0xFF,0x80,0x00,0x00,0x1F,0xFF,0x70,0x4F,0xFF,0x20,0x00,0x00,0x0A,0xFF,0xB0,0x9F,0xFB,0x00,0x00,0x00,0x05,0xFF,0xF1,0xDF,0xF6,0x00,0x00,0x00,0x00,0xDF,0xF9,0xFF,0xE1,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x0B,0xFF,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [v]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFC,0x00,0xCF,0xE0,0x08,0xFF,0xC0,0xAF,0xFE,0x00,0xEF,0xF2,0x0A,0xFF,0xA0,0x7F,0xFF,0x12,0xFF,0xF5,0x0C,0xFF,0x80,0x5F,0xFF,0x34,0xFF,0xF7,0x0E,0xFF,0x50,0x2F,0xFF,0x56,0xFE,0xFA,0x1F,0xFF,0x30,0x0E,0xFF,0x79,0xFA,0xFC,0x3F,0xFF,0x00,0x0C,0xFF,0x8B,0xF6,0xFE,0x5F,0xFD,0x00,0x09,0xFF,0xAD,0xF2,0xFF,0x8F,0xFA,0x00,0x07,0xFF,0xCF,0xE0,0xDF,0xBF,0xF8,0x00,0x04,0xFF,0xFF,0xB0,0xBF,0xFF,0xF6,0x00,0x02,0xFF,0xFF,0x90,0x8F,0xFF,0xF3,0x00,0x00,0xEF,0xFF,0x60,0x6F,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [w]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF7,0x00,0x05,0xFF,0xF7,0x00,0x00,0xBF,0xFF,0x30,0x1D,0xFF,0xC0,0x00,0x00,0x2E,0xFF,0xC0,0x7F,0xFF,0x20,0x00,0x00,0x05,0xFF,0xF8,0xEF,0xF7,0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFE,0x20,0x00,0x00,0x00,0x01,0xEF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x0A,0xFF,0xC6,0xFF,0xF7,0x00,0x00,0x00,0x6F,0xFF,0x40,0xAF,0xFF,0x40,0x00,0x02,0xEF,0xFB,0x00,0x1E,0xFF,0xD1,0x00,0x0B,0xFF,0xE2,0x00,0x04,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [x]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0x90,0x00,0x00,0x6F,0xFF,0x10,0x08,0xFF,0xE1,0x00,0x00,0xBF,0xFA,0x00,0x02,0xFF,0xF6,0x00,0x01,0xFF,0xF4,0x00,0x00,0xAF,0xFC,0x00,0x06,0xFF,0xD0,0x00,0x00,0x3F,0xFF,0x30,0x0B,0xFF,0x70,0x00,0x00,0x0B,0xFF,0x90,0x1F,0xFF,0x20,0x00,0x00,0x05,0xFF,0xE0,0x6F,0xFA,0x00,0x00,0x00,0x00,0xDF,0xF4,0xBF,0xF4,0x00,0x00,0x00,0x00,0x6F,0xF9,0xFF,0xD0,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x01,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF5,0x00,0x00,0x00,0x00,0x10,0x3C,0xFF,0xD0,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x01,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x03,0xEF,0xEB,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [y]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0x00,0x00,0x04,0xFF,0xFD,0x20,0x00,0x00,0x00,0x00,0x3E,0xFF,0xE2,0x00,0x00,0x00,0x00,0x03,0xEF,0xFE,0x30,0x00,0x00,0x00,0x00,0x2E,0xFF,0xE3,0x00,0x00,0x00,0x00,0x02,0xDF,0xFF,0x40,0x00,0x00,0x00,0x00,0x1D,0xFF,0xF5,0x00,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [z]
+0x00,0x00,0x00,0x06,0xCE,0xFF,0x60,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x02,0xFF,0xF5,0x10,0x00,0x00,0x00,0x00,0x02,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xE0,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xE0,0x00,0x00,0x00,0x00,0x01,0x5C,0xFF,0xC0,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x5F,0xFF,0xD4,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x01,0x4B,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x17,0xCE,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [{]
+0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [|]
+0x00,0x6F,0xFE,0xC7,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x16,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF3,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFC,0x51,0x00,0x00,0x00,0x00,0x00,0x4E,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x04,0xDF,0xFF,0x60,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0xCF,0xFC,0x41,0x00,0x00,0x00,0x00,0x00,0xEF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF3,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xF3,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xF1,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x6F,0xFE,0xC8,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [}]
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xCE,0xB3,0x00,0x0B,0xA2,0x00,0x00,0x5F,0xFF,0xFF,0x71,0x6F,0xF7,0x00,0x01,0xEF,0xFF,0xFF,0xFF,0xFF,0xE1,0x00,0x07,0xFF,0x71,0x7F,0xFF,0xFF,0x50,0x00,0x02,0xAB,0x00,0x03,0xBF,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // Ascii = [~]
+};
+
+// Printable ASCII, 32..126
+static const font_range_t ascii_ranges[] = {
+    {0x0020, 95, 0},
+};
+
 font_def_t font_table[FONT_TYPE_COUNT] = {
-    {7, 10, font_small},
-    {11, 18, font_medium},
-    {16, 26, font_large}
-};
\ No newline at end of file
+    {7, 10, font_small, 0, NULL, ascii_ranges, 1},
+    {11, 18, font_medium, 0, NULL, ascii_ranges, 1},
+    {16, 26, font_large, 4, font_large_aa, ascii_ranges, 1}
+};
+
+uint16_t font_glyph(const font_def_t* font, uint32_t codepoint) {
+    uint8_t low = 0;
+    uint8_t high = font->range_count;
+
+    while (low < high) {
+        uint8_t mid = (low + high) / 2;
+        const font_range_t* range = &font->ranges[mid];
+
+        if (codepoint < range->first) {
+            high = mid;
+        } else if (codepoint >= (uint32_t)range->first + range->count) {
+            low = mid + 1;
+        } else {
+            return range->glyph + (codepoint - range->first);
+        }
+    }
+    return FONT_NO_GLYPH;
+}
+
+uint32_t utf8_next(const char** text) {
+    const uint8_t* p = (const uint8_t*)*text;
+    uint32_t codepoint;
+    uint8_t extra;
+
+    if (p[0] < 0x80) {
+        *text += 1;
+        return p[0];
+    } else if ((p[0] & 0xE0) == 0xC0) {
+        codepoint = p[0] & 0x1F;
+        extra = 1;
+    } else if ((p[0] & 0xF0) == 0xE0) {
+        codepoint = p[0] & 0x0F;
+        extra = 2;
+    } else if ((p[0] & 0xF8) == 0xF0) {
+        codepoint = p[0] & 0x07;
+        extra = 3;
+    } else {
+        *text += 1;
+        return 0xFFFD;
+    }
+
+    for (uint8_t i = 1; i <= extra; ++i) {
+        // Also stops at the terminator, which is no continuation byte
+        if ((p[i] & 0xC0) != 0x80) {
+            *text += 1;
+            return 0xFFFD;
+        }
+        codepoint = (codepoint << 6) | (p[i] & 0x3F);
+    }
+
+    // Overlong forms and surrogates are not characters
+    static const uint32_t min_codepoint[] = {0, 0x80, 0x800, 0x10000};
+    if (codepoint < min_codepoint[extra] || (codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF) {
+        *text += 1;
+        return 0xFFFD;
+    }
+
+    *text += extra + 1;
+    return codepoint;
+}
\ No newline at end of file
@@ -4,12 +4,33 @@
 #include "script_types.h"
 #include <stdint.h>
 
+// Consecutive codepoints with consecutive glyphs. A font lists its ranges
+// sorted by `first`, glyphs are stored in codepoint order.
+typedef struct {
+    uint16_t first;             // first codepoint of the range
+    uint16_t count;
+    uint16_t glyph;             // glyph index of `first`
+} font_range_t;
+
 typedef struct {
     uint8_t width;
     uint8_t height;
-    const uint16_t* data;
+    const uint16_t* data;       // 1bpp rows, MSB is the left column
+    uint8_t aa_bpp;             // depth of the coverage glyphs (2 or 4), 0 if the font has none
+    const uint8_t* aa_data;     // coverage glyphs from font_generator.py -b, rows padded to whole bytes
+    const font_range_t* ranges; // codepoints the font has, from font_generator.py --charset
+    uint8_t range_count;
 } font_def_t;
 
+#define FONT_NO_GLYPH           UINT16_MAX
+
 extern font_def_t font_table[FONT_TYPE_COUNT];
 
+// Glyph index of a codepoint, binary search over the ranges; FONT_NO_GLYPH if the font lacks it
+uint16_t font_glyph(const font_def_t* font, uint32_t codepoint);
+
+// Decode the UTF-8 sequence at *text and move past it. A malformed or
+// truncated sequence yields U+FFFD and skips one byte.
+uint32_t utf8_next(const char** text);
+
 #endif /* FONTS_H */
\ No newline at end of file
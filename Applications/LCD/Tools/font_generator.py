@@ -15,8 +15,13 @@ class FontGenerator:
         self.arg_parser.add_argument('-s', '--size', required=True, type=int, help="Size of font in px. Note: actual size of bitmap may be different")
         self.arg_parser.add_argument('-p', '--proportional', action='store_true', help="Generate array of char width (for non-monospaced fonts)")
         self.arg_parser.add_argument('-a', '--atlas', type=str, help="Font atlas file with extension (e.g. atlas.png)")
-        self.arg_parser.add_argument('--charset', default="ascii", type=str, help="Specific charset (not supported by library)")
+        self.arg_parser.add_argument('--charset', default="ascii", type=str,
+                                     help="UTF-8 file with the characters to include, in any order (default: printable ASCII)")
         self.arg_parser.add_argument('--string', type=str)
+        self.arg_parser.add_argument('-b', '--bpp', default=1, type=int, choices=[1, 2, 4],
+                                     help="Bits per pixel: 1 for plain bitmaps, 2 or 4 for anti-aliased coverage glyphs")
+        self.arg_parser.add_argument('--cell', type=str,
+                                     help="Pad or crop coverage glyphs to WIDTHxHEIGHT (e.g. 16x26) to match an existing font")
         self.args = self.arg_parser.parse_args()
 
         """ Charsets """
@@ -38,7 +43,9 @@ class FontGenerator:
                 self.charset = [char for char in self.ascii]
             case _:
                 with open(self.args.charset, 'r', encoding='utf-8') as file:
-                    self.charset = [char for char in file.read()]
+                    chars = set(char for char in file.read() if char.isprintable() and ord(char) <= 0xFFFF)
+                # Glyphs are stored in codepoint order, the firmware finds them through the range table
+                self.charset = sorted(chars, key=ord)
 
     def load_font(self):
         """Load the TrueType font file."""
@@ -62,9 +69,17 @@ class FontGenerator:
                 self.widths.append(0)
         self.widths = [w - self.x_min if w >= self.x_min else 0 for w in self.widths]
         self.res = (ceil((self.x_max - self.x_min) / 16) * 16, self.y_max - self.y_min)
+        if self.args.bpp > 1:
+            # Coverage glyphs are packed per byte, no need to round up to 16 columns
+            self.res = (self.x_max - self.x_min, self.y_max - self.y_min)
+            if self.args.cell:
+                self.res = tuple(int(v) for v in self.args.cell.lower().split('x'))
 
     def convert_to_bytes(self):
         """Convert font characters to byte arrays."""
+        if self.args.bpp > 1:
+            self.convert_to_coverage()
+            return
         self.pixels = []
         for char in self.charset:
             out = Image.new("1", self.res, 0)
@@ -72,38 +87,86 @@ class FontGenerator:
             d.text((-self.x_min, -self.y_min), char, font=self.font, fill=1)
             self.pixels.append(out.tobytes())
 
+    def convert_to_coverage(self):
+        """Render anti-aliased glyphs and quantize coverage to bpp levels, packed MSB first."""
+        max_level = (1 << self.args.bpp) - 1
+        pixels_per_byte = 8 // self.args.bpp
+        stride = ceil(self.res[0] / pixels_per_byte)
+        # Center the glyph box horizontally when the cell is wider than the font
+        x_offset = (self.res[0] - (self.x_max - self.x_min)) // 2
+        self.pixels = []
+        for char in self.charset:
+            out = Image.new("L", self.res, 0)
+            d = ImageDraw.Draw(out)
+            d.text((x_offset - self.x_min, -self.y_min), char, font=self.font, fill=255)
+            data = bytearray(stride * self.res[1])
+            for y in range(self.res[1]):
+                for x in range(self.res[0]):
+                    level = (out.getpixel((x, y)) * max_level + 127) // 255
+                    shift = (pixels_per_byte - 1 - (x % pixels_per_byte)) * self.args.bpp
+                    data[y * stride + x // pixels_per_byte] |= level << shift
+            self.pixels.append(bytes(data))
+
+    def _ranges(self):
+        """Group the sorted charset into runs of consecutive codepoints: [first, count, glyph index]."""
+        ranges = []
+        for index, char in enumerate(self.charset):
+            if ranges and ranges[-1][0] + ranges[-1][1] == ord(char):
+                ranges[-1][1] += 1
+            else:
+                ranges.append([ord(char), 1, index])
+        if len(ranges) > 255:
+            raise RuntimeError(f"{len(ranges)} codepoint ranges, font_def_t takes up to 255")
+        return ranges
+
+    def write_ranges(self, fd, name):
+        """Write the font_range_t table of the charset, searched by font_glyph() in Fonts/fonts.c."""
+        ranges = self._ranges()
+        fd.write(f"static const font_range_t {name}_ranges[] = {{\n")
+        for first, count, glyph in ranges:
+            fd.write(f"    {{0x{first:04X}, {count}, {glyph}}},\n")
+        fd.write("};\n")
+        return len(ranges)
+
+    def generate_coverage_c(self):
+        """Generate C code for anti-aliased glyphs, in the layout of Fonts/fonts.c."""
+        with open("font.c", "w", encoding='utf-8') as fd:
+            fnt_name = self.font.getname()
+            name = f"font_{self.res[0]}x{self.res[1]}_aa{self.args.bpp}"
+            fd.write(f"// Generated {fnt_name[0]} {fnt_name[1]} {self.args.size}, "
+                     f"{self.args.bpp} bpp coverage, {self.res[0]}x{self.res[1]}\n")
+            fd.write(f"static const uint8_t {name} [] = {{\n")
+            for index, char in enumerate(self.pixels):
+                fd.write(",".join(f"0x{byte:02X}" for byte in char))
+                fd.write(f", // U+{ord(self.charset[index]):04X} [{self.charset[index]}]\n")
+            fd.write("};\n\n")
+            # Glyph indices must match the 1bpp font it pairs with: generate both from the same charset
+            self.write_ranges(fd, name)
+
     def generate_font_c(self):
         """Generate C code for the font."""
-        if not self.args.string:
+        if not self.args.string and self.args.bpp > 1:
+            self.generate_coverage_c()
+        elif not self.args.string:
+            width = self.x_max - self.x_min
+            if width > 16:
+                raise RuntimeError(f"Glyphs are {width} px wide, font rows in Fonts/fonts.c are 16 bit")
             with open("font.c", "w", encoding='utf-8') as fd:
                 fnt_name = self.font.getname()
-                fd.write(f"/** Generated {fnt_name[0]} {fnt_name[1]} {self.args.size} "
-                         "file by generate.py*/\n")
-                words = [[(char[byte], char[byte + 1] if len(char) >= byte + 1 else 0)
-                         for byte in range(0, len(char), 2)] for char in self.pixels]
-                fd.write("#include <stdint.h>\n")
-                fd.write("#include \"ssd1306_fonts.h\"\n\n")
-                fd.write(f"static const uint16_t Font{(self.x_max - self.x_min)}x{self.res[1]} [] = {{\n")
-                for index, char in enumerate(words):
-                    assert (len(char) == (self.res[1] * ceil((self.x_max - self.x_min) / 16)))
-                    fd.write(f"/** {self.charset[index]} **/\n")
-                    for word in char:
-                        fd.write(f"0x{word[0]:02X}{word[1]:02X},")
-                    fd.write("\n")
+                name = f"font_{width}x{self.res[1]}"
+                fd.write(f"// Generated {fnt_name[0]} {fnt_name[1]} {self.args.size}, {width}x{self.res[1]}\n")
+                fd.write(f"static const uint16_t {name} [] = {{\n")
+                for index, char in enumerate(self.pixels):
+                    fd.write(", ".join(f"0x{char[row * 2]:02X}{char[row * 2 + 1]:02X}" for row in range(self.res[1])))
+                    fd.write(f",  // U+{ord(self.charset[index]):04X} [{self.charset[index]}]\n")
                 fd.write("};\n\n")
                 if self.args.proportional:
-                    fd.write("static const uint8_t char_width[] = {\n")
-                    for index, width in enumerate(self.widths):
-                        fd.write(f"  {width},  /** {self.charset[index]} **/\n")
+                    fd.write(f"static const uint8_t {name}_widths[] = {{\n")
+                    for index, width_px in enumerate(self.widths):
+                        fd.write(f"    {width_px},  // {self.charset[index]}\n")
                     fd.write("};\n\n")
-                fd.write(f"/** Generated {fnt_name[0]} {fnt_name[1]} {self.args.size} */\n")
-                fd.write(f"const SSD1306_Font_t Font_{(self.x_max - self.x_min)}x{self.res[1]} = "
-                         f"{{{self.x_max - self.x_min}, {self.res[1]}, Font{(self.x_max - self.x_min)}x{self.res[1]}, ")
-                if self.args.proportional:
-                    fd.write("char_width")
-                else:
-                    fd.write("NULL")
-                fd.write("};\n")
+                range_count = self.write_ranges(fd, name)
+                fd.write(f"\n// font_table entry: {{{width}, {self.res[1]}, {name}, 0, NULL, {name}_ranges, {range_count}}}\n")
 
     def generate_string_c(self):
         """Generate C code for a specific string bitmap."""
@@ -125,7 +188,7 @@ class FontGenerator:
 
     def generate_atlas(self):
         """Generate a font atlas image."""
-        if self.args.atlas:
+        if self.args.atlas and self.args.bpp == 1:
             atlas_res = ((self.x_max - self.x_min) * 16 + 17, (self.res[1] + 1) *
                          ceil(len(self.charset) / 16) + 1)
             atlas = Image.new("RGB", atlas_res, 0)
@@ -3,6 +3,8 @@ import os
 import struct
 import subprocess
 
+from PIL import Image
+
 
 class LayoutBuilder:
     def __init__(self, tml_file="layout.tml", bin_file="layout.bin", obj_file="layout.o"):
@@ -12,6 +14,8 @@ class LayoutBuilder:
         self.size = 0
         self.content = b""
         self.layout_table = []
+        self.images = []        # (width, height, encoding, data) in image index order
+        self.image_index = {}   # source path -> image index
 
         self.color_map = {
             "white": "0xFFFF", "black": "0x0000", "red": "0xF800",
@@ -32,13 +36,46 @@ class LayoutBuilder:
             "large": "2"
         }
 
+        self.bool_map = {
+            "true": "1",
+            "false": "0"
+        }
+
+        # Keep in sync with easing_t and tween_repeat_t in layout_timeline.h
+        self.easing_map = {
+            "linear": "0",
+            "in": "1",
+            "out": "2",
+            "in_out": "3"
+        }
+
+        self.repeat_map = {
+            "once": "0",
+            "loop": "1",
+            "alternate": "2"
+        }
+
+        # Drawable elements inside an Area and the marker the renderer expects
+        self.element_map = {
+            "Text": "<TEXT>",
+            "Rect": "<RECT>",
+            "Line": "<LINE>",
+            "Image": "<IMAGE>"
+        }
+
+        # Compiled-in widgets: index in widget_type_t (layout_widgets.h) and their own properties
+        self.widget_map = {
+            "NaviBar": {"type": 0, "props": ["total", "current"]},
+        }
+        self.widget_common_props = ["x", "y", "width", "height", "color", "background", "align", "tween"]
+
     def _pad_to_4(self, f):
         padding = (4 - (f.tell() % 4)) % 4
         f.write(b'\x00' * padding)
 
     def _hex_to_rgb565(self, value):
         value = value.lstrip("#")
-        if len(value) == 6:
+        if re.fullmatch(r'[\da-fA-F]{6}', value):
             r, g, b = int(value[:2], 16), int(value[2:4], 16), int(value[4:], 16)
             rgb565 = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
             return f"0x{rgb565:04X}"
@@ -50,7 +87,24 @@ class LayoutBuilder:
             h = ((h << 5) + h) + c
         return h & 0xFFFFFFFF
 
+    def _tween(self, spec):
+        # "key from to ms [easing] [repeat]" -> "key from to ms easing# repeat#"
+        parts = spec.split()
+        if len(parts) < 4:
+            print(f"[⚠️] tween '{spec}' needs a property, two values and a duration")
+            return spec
+        key, start, end, duration = parts[:4]
+        easing = parts[4] if len(parts) > 4 else "linear"
+        repeat = parts[5] if len(parts) > 5 else "once"
+        if key in ("color", "background"):
+            start, end = self._hex_to_rgb565(start), self._hex_to_rgb565(end)
+        return (f"{key} {start} {end} {duration} "
+                f"{self.easing_map.get(easing, easing)} {self.repeat_map.get(repeat, repeat)}")
+
     def _clean_content(self, raw):
+        # Replace tweens, their colors converted like color properties
+        raw = re.sub(r'tween:\s*"([^"]*)"', lambda m: f'tween:{self._tween(m.group(1))}', raw)
+
         # Replace colors
         raw = re.sub(r'color:\s*"(#[\da-fA-F]{6}|[a-zA-Z]+)"',
                      lambda m: f'color:{self._hex_to_rgb565(m.group(1))}', raw)
@@ -64,6 +118,12 @@ class LayoutBuilder:
         # Replace font
         raw = re.sub(r'font:\s*([a-zA-Z]+)',
                      lambda m: f'font:{self.font_map.get(m.group(1), m.group(1))}' ,raw)
+
+        # Replace booleans
+        raw = re.sub(r'fill:\s*([a-zA-Z]+)',
+                     lambda m: f'fill:{self.bool_map.get(m.group(1), m.group(1))}' ,raw)
+        raw = re.sub(r'idle:\s*([a-zA-Z]+)',
+                     lambda m: f'idle:{self.bool_map.get(m.group(1), m.group(1))}' ,raw)
         
         # Remove double qoutes
         raw = re.sub(r'"(.*?)"', r'\1', raw)
@@ -130,11 +190,93 @@ class LayoutBuilder:
             output += processed
         return output
 
+    def _load_bitmap(self, path):
+        """Load a PNG as 1bpp: transparent pixels are background, mid tones are dithered."""
+        img = Image.open(path)
+        if img.mode in ("RGBA", "LA", "P"):
+            img = img.convert("RGBA")
+            canvas = Image.new("RGBA", img.size, (0, 0, 0, 255))
+            canvas.alpha_composite(img)
+            img = canvas
+        gray = img.convert("L")
+
+        # Line art converts with a plain threshold, photos and anti-aliased art need dithering
+        histogram = gray.histogram()
+        mid_tones = sum(histogram[32:224])
+        if mid_tones * 10 > gray.width * gray.height:
+            return gray.convert("1", dither=Image.Dither.FLOYDSTEINBERG)
+        return gray.point(lambda v: 255 if v >= 128 else 0).convert("1", dither=Image.Dither.NONE)
+
+    def _encode_rle(self, bitmap):
+        """Row RLE: run lengths alternating background/foreground, starting with background.
+        Runs longer than 255 are split with a zero-length run of the other color."""
+        out = bytearray()
+        width, height = bitmap.size
+        for y in range(height):
+            row = [1 if bitmap.getpixel((x, y)) else 0 for x in range(width)]
+            color, x = 0, 0
+            while x < width:
+                run = 0
+                while x + run < width and row[x + run] == color:
+                    run += 1
+                while run > 255:
+                    out += bytes([255, 0])
+                    run -= 255
+                out.append(run)
+                x += run
+                color ^= 1
+        return bytes(out)
+
+    def _encode_raw(self, bitmap):
+        """Plain rows, MSB first, padded to whole bytes."""
+        return bitmap.tobytes()
+
+    def _add_image(self, src):
+        """Convert an image once and return its index in the image table."""
+        path = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(self.tml_file)), src))
+        if path in self.image_index:
+            return self.image_index[path]
+        if not os.path.exists(path):
+            print(f"[❌] Image not found: {src}")
+            return None
+
+        bitmap = self._load_bitmap(path)
+        rle = self._encode_rle(bitmap)
+        raw = self._encode_raw(bitmap)
+
+        # Detailed images compress badly, keep whichever is smaller (0: RLE, 1: raw)
+        encoding, data = (0, rle) if len(rle) <= len(raw) else (1, raw)
+        self.image_index[path] = len(self.images)
+        self.images.append((bitmap.width, bitmap.height, encoding, data))
+        print(f"[🖼️] {src}: {bitmap.width}x{bitmap.height}, {len(rle)} bytes RLE, "
+              f"{len(raw)} bytes raw, stored {'raw' if encoding else 'RLE'}")
+        return self.image_index[path]
+
     def _strip_braces(self, content):
-        return '\n'.join(
-            line for line in content.splitlines()
-            if line.strip() and '{' not in line and '}' not in line
-        )
+        lines = []
+        widget = None
+        for line in content.splitlines():
+            stripped = line.strip()
+            if not stripped:
+                continue
+            if stripped.endswith('{') and stripped[:-1] in self.element_map:
+                lines.append(self.element_map[stripped[:-1]])
+                widget = None
+            elif stripped.endswith('{') and stripped[:-1] in self.widget_map:
+                widget = stripped[:-1]
+                lines.append(f"<WIDGET:{self.widget_map[widget]['type']}>")
+            elif stripped.startswith('src:'):
+                index = self._add_image(stripped[len('src:'):])
+                if index is not None:
+                    lines.append(f"image:{index}")
+            elif '{' not in stripped and '}' not in stripped:
+                key = stripped.split(':')[0]
+                if widget and key not in self.widget_map[widget]['props'] + self.widget_common_props:
+                    print(f"[⚠️] {widget} has no property '{key}', ignored by the renderer")
+                lines.append(stripped)
+            elif '}' in stripped:
+                widget = None
+        return '\n'.join(lines)
 
     def _build_layout_table(self, content):
         layout_matches = list(re.finditer(r'id\s*:', content))
@@ -170,6 +312,17 @@ class LayoutBuilder:
                                     entry['size'],
                                     entry['area_count'],
                                     entry['ph_cnt']))
+
+            # Image table after the layout table: count, then width/height/encoding/offset
+            # per image with offsets from the end of the table, followed by the image data
+            self._pad_to_4(f)
+            f.write(struct.pack('<I', len(self.images)))
+            offset = 0
+            for width, height, encoding, data in self.images:
+                f.write(struct.pack('<HHBxxxI', width, height, encoding, offset))
+                offset += len(data)
+            for _, _, _, data in self.images:
+                f.write(data)
         print(f"[✅] layout.bin generated with {len(self.layout_table)} layouts")
 
     def _generate_object_file(self):
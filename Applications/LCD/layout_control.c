@@ -1,5 +1,8 @@
 #include "main.h"
 #include "layout_control.h"
+#include "layout_timeline.h"
+
+extern EventGroupHandle_t display_event;
 
 void process_layout_script(void) {
      uint8_t test_buffer[1][101] = {
@@ -15,4 +18,23 @@ void process_layout_script(void) {
     }
 
     render_layout();
-}
\ No newline at end of file
+}
+
+// Fixed-rate frame tick: an update that found no free page is drawn once one is,
+// and while tweens run, what they moved is redrawn; the display sends the frame
+void layout_task(void* param) {
+    (void)param;
+    TickType_t wake = xTaskGetTickCount();
+
+    for (;;) {
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(TIMELINE_FRAME_MS));
+
+        if (is_render_pending()) {
+            if (render_layout()) {
+                xEventGroupSetBits(display_event, DISPLAY_EVENT_UPDATE);
+            }
+        } else if (is_layout_animating() && render_animation_frame()) {
+            xEventGroupSetBits(display_event, DISPLAY_EVENT_UPDATE);
+        }
+    }
+}
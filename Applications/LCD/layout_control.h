@@ -6,5 +6,6 @@
 #include "layout_renderer.h"
 
 void process_layout_script(void);
+void layout_task(void* param);
 
 #endif /* LAYOUT_CONTROL_H */
\ No newline at end of file
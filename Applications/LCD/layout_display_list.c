@@ -0,0 +1,540 @@
+#include "main.h"
+#include "layout_display_list.h"
+#include "layout_primitives.h"
+
+#if ILI9341_DISPLAY_LIST
+
+#define DL_MAX_COMMANDS     64
+#define DL_BAND_HEIGHT      8
+// Bands cover the long side, a rotated page is ILI9341_WIDTH rows high
+#define DL_BAND_COUNT       ((ILI9341_WIDTH + DL_BAND_HEIGHT - 1) / DL_BAND_HEIGHT)
+#define DL_BAND_WORDS       (DL_MAX_COMMANDS / 32)
+
+typedef enum {
+    DL_FILL = 0,        // solid clip rectangle
+    DL_ROUND_RECT,      // rounded rectangle, outline or filled; radius 0 is a plain rectangle
+    DL_LINE,            // Bresenham line, not horizontal nor vertical
+    DL_IMAGE,           // 1bpp image, RLE or raw
+    DL_TEXT,            // run of glyphs of one font
+} dl_command_type_t;
+
+#define DL_FLAG_FILLED      0x01    // round rect interior is painted
+#define DL_FLAG_RLE         0x02    // image data is row RLE, see draw_rle_image()
+#define DL_FLAG_AA          0x04    // text uses the coverage glyphs through `levels`
+
+typedef struct {
+    uint8_t type;
+    uint8_t flags;
+    uint8_t fg, bg;
+    clip_rect_t clip;           // visible part of the shape, inclusive
+    int16_t x, y;               // shape origin (line: top end point)
+    uint16_t w, h;              // shape size
+    union {
+        uint16_t radius;
+        struct {
+            int16_t x1, y1;     // bottom end point
+            int16_t cx, cy;     // first pixel of row cy, scanout resumes from there
+            int32_t err;
+        } line;
+        struct {
+            const uint8_t* data;
+            const uint8_t* cursor;  // RLE: start of row cursor_row
+            uint16_t cursor_row;
+        } image;
+        struct {
+            const font_def_t* font;
+            uint16_t offset;        // into the glyph pool
+            uint8_t length;
+            uint8_t spacing;
+            uint8_t levels[8];      // two coverage levels per byte, high nibble first
+        } text;
+    };
+} dl_command_t;
+
+typedef struct {
+    uint16_t count;
+    uint16_t dropped;
+    uint16_t glyphs_used;
+    uint32_t bands[DL_BAND_COUNT][DL_BAND_WORDS];   // commands touching each band, bit n = command n
+    dl_command_t commands[DL_MAX_COMMANDS];
+    uint16_t glyphs[];                              // glyph pool of the text runs, the rest of the page
+} display_list_t;
+
+#define DL_GLYPH_POOL_SIZE  ((ILI9341_DISPLAY_LIST_SIZE - sizeof(display_list_t)) / sizeof(uint16_t))
+
+_Static_assert(sizeof(display_list_t) < ILI9341_DISPLAY_LIST_SIZE, "display list does not fit a page");
+
+// Part of the row being rasterized that the current command may write
+typedef struct {
+    uint16_t* out;              // pixel of screen column `origin`
+    int16_t origin;
+    int16_t x0, x1;             // command clip on this row, inclusive
+    const uint16_t* palette;
+} dl_row_t;
+
+static inline int16_t min_i16(int16_t a, int16_t b) { return (a < b) ? a : b; }
+static inline int16_t max_i16(int16_t a, int16_t b) { return (a > b) ? a : b; }
+
+static uint16_t clamp_radius(uint16_t w, uint16_t h, uint16_t r) {
+    uint16_t limit = ((w < h) ? w : h) / 2;
+    return (r > limit) ? limit : r;
+}
+
+/* ----------------- Recording --------------------- */
+
+void display_list_begin(uint8_t* page) {
+    display_list_t* list = (display_list_t*)page;
+
+    list->count = 0;
+    list->dropped = 0;
+    list->glyphs_used = 0;
+    memset(list->bands, 0, sizeof(list->bands));
+}
+
+uint16_t display_list_dropped(const uint8_t* page) {
+    return ((const display_list_t*)page)->dropped;
+}
+
+// Append a command covering the inclusive box, clipped; NULL if nothing is visible or the list is full
+static dl_command_t* record(uint8_t* page, uint8_t type, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint8_t fg) {
+    display_list_t* list = (display_list_t*)page;
+
+    if (!clip_box(&x0, &y0, &x1, &y1)) return NULL;
+    if (list->count >= DL_MAX_COMMANDS) {
+        list->dropped++;
+        return NULL;
+    }
+
+    uint8_t index = list->count++;
+    for (uint16_t band = y0 / DL_BAND_HEIGHT; band <= y1 / DL_BAND_HEIGHT; ++band) {
+        list->bands[band][index / 32] |= 1u << (index % 32);
+    }
+
+    dl_command_t* cmd = &list->commands[index];
+    cmd->type = type;
+    cmd->flags = 0;
+    cmd->fg = fg;
+    cmd->bg = fg;
+    cmd->clip.x0 = x0;
+    cmd->clip.y0 = y0;
+    cmd->clip.x1 = x1;
+    cmd->clip.y1 = y1;
+    return cmd;
+}
+
+uint16_t display_list_text(uint8_t* page, int16_t x, int16_t y, const uint16_t* glyphs, uint8_t length,
+                           const font_def_t* font, uint8_t spacing, uint8_t fg, uint8_t bg,
+                           const uint8_t* levels) {
+    display_list_t* list = (display_list_t*)page;
+    uint16_t pitch = font->width + spacing;
+
+    if (length == 0) return 0;
+
+    uint16_t run_width = length * pitch - spacing;
+    if (list->glyphs_used + length > DL_GLYPH_POOL_SIZE) {
+        list->dropped++;
+        return run_width;
+    }
+
+    dl_command_t* cmd = record(page, DL_TEXT, x, y, x + run_width - 1, y + font->height - 1, fg);
+    if (!cmd) return run_width;
+
+    cmd->bg = bg;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->w = run_width;
+    cmd->h = font->height;
+    cmd->text.font = font;
+    cmd->text.offset = list->glyphs_used;
+    cmd->text.length = length;
+    cmd->text.spacing = spacing;
+
+    memcpy(&list->glyphs[list->glyphs_used], glyphs, length * sizeof(uint16_t));
+    list->glyphs_used += length;
+
+    if (levels && font->aa_data) {
+        cmd->flags |= DL_FLAG_AA;
+        for (uint8_t level = 0; level < 16; level += 2) {
+            uint8_t max_level = (1 << font->aa_bpp) - 1;
+            uint8_t high = levels[(level <= max_level) ? level : max_level];
+            uint8_t low = levels[(level + 1 <= max_level) ? level + 1 : max_level];
+            cmd->text.levels[level / 2] = (uint8_t)((high << 4) | (low & 0x0F));
+        }
+    }
+    return run_width;
+}
+
+void draw_pixel(uint8_t* fb, int16_t x, int16_t y, uint8_t color) {
+    record(fb, DL_FILL, x, y, x, y, color);
+}
+
+void fill_span(uint8_t* fb, int16_t x0, int16_t x1, int16_t y, uint8_t color) {
+    if (x0 > x1) {
+        int16_t t = x0; x0 = x1; x1 = t;
+    }
+    record(fb, DL_FILL, x0, y, x1, y, color);
+}
+
+// Straight lines are fills; others keep their end points, top one first
+void draw_line(uint8_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color) {
+    if (y0 == y1 || x0 == x1) {
+        record(fb, DL_FILL, min_i16(x0, x1), min_i16(y0, y1), max_i16(x0, x1), max_i16(y0, y1), color);
+        return;
+    }
+    if (y0 > y1) {
+        int16_t t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+
+    dl_command_t* cmd = record(fb, DL_LINE, min_i16(x0, x1), y0, max_i16(x0, x1), y1, color);
+    if (!cmd) return;
+
+    cmd->x = x0;
+    cmd->y = y0;
+    cmd->line.x1 = x1;
+    cmd->line.y1 = y1;
+    cmd->line.cx = x0;
+    cmd->line.cy = y0;
+    cmd->line.err = ((x1 > x0) ? (x1 - x0) : (x0 - x1)) - (y1 - y0);
+}
+
+static void record_round_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r,
+                              uint8_t color, uint8_t flags) {
+    if (w == 0 || h == 0) return;
+
+    // A filled square corner is a plain fill
+    r = clamp_radius(w, h, r);
+    uint8_t type = (r == 0 && (flags & DL_FLAG_FILLED)) ? DL_FILL : DL_ROUND_RECT;
+    dl_command_t* cmd = record(fb, type, x, y, x + w - 1, y + h - 1, color);
+    if (!cmd) return;
+
+    cmd->flags = flags;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->w = w;
+    cmd->h = h;
+    cmd->radius = r;
+}
+
+void draw_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t color) {
+    record_round_rect(fb, x, y, w, h, 0, color, 0);
+}
+
+void fill_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t color) {
+    record_round_rect(fb, x, y, w, h, 0, color, DL_FLAG_FILLED);
+}
+
+void draw_round_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint8_t color) {
+    record_round_rect(fb, x, y, w, h, r, color, 0);
+}
+
+void fill_round_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint8_t color) {
+    record_round_rect(fb, x, y, w, h, r, color, DL_FLAG_FILLED);
+}
+
+static void record_image(uint8_t* fb, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                         const uint8_t* data, uint8_t fg, uint8_t bg, uint8_t flags) {
+    if (width == 0 || height == 0) return;
+
+    dl_command_t* cmd = record(fb, DL_IMAGE, x, y, x + width - 1, y + height - 1, fg);
+    if (!cmd) return;
+
+    cmd->flags = flags;
+    cmd->bg = bg;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->w = width;
+    cmd->h = height;
+    cmd->image.data = data;
+    cmd->image.cursor = data;
+    cmd->image.cursor_row = 0;
+}
+
+void draw_rle_image(uint8_t* fb, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                    const uint8_t* data, uint8_t fg, uint8_t bg) {
+    record_image(fb, x, y, width, height, data, fg, bg, DL_FLAG_RLE);
+}
+
+void draw_bitmap(uint8_t* fb, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                 const uint8_t* data, uint8_t fg, uint8_t bg) {
+    record_image(fb, x, y, width, height, data, fg, bg, 0);
+}
+
+/* ----------------- Rasterizing --------------------- */
+
+// Ends in either order, like fill_span()
+static inline void row_span(const dl_row_t* row, int16_t x0, int16_t x1, uint16_t color) {
+    if (x0 > x1) {
+        int16_t t = x0; x0 = x1; x1 = t;
+    }
+    x0 = max_i16(x0, row->x0);
+    x1 = min_i16(x1, row->x1);
+    for (int16_t x = x0; x <= x1; ++x) {
+        row->out[x - row->origin] = color;
+    }
+}
+
+static inline void row_plot(const dl_row_t* row, int16_t x, uint16_t color) {
+    if (x >= row->x0 && x <= row->x1) {
+        row->out[x - row->origin] = color;
+    }
+}
+
+// Points of the midpoint walk of a corner circle lying `d` rows from its center.
+// Outlines get them plotted; returns the widest offset, -1 if none.
+static int16_t corner_row(const dl_row_t* row, int16_t r, int16_t d, int16_t left, int16_t right,
+                          uint16_t color, bool plot) {
+    int16_t extent = -1;
+    int16_t px = 0;
+    int16_t py = r;
+    int32_t f = 1 - r;
+
+    // px only grows and py only shrinks: past both sides of d nothing can match
+    while (px <= py && !(px > d && py < d)) {
+        if (py == d) {
+            extent = max_i16(extent, px);
+            if (plot) {
+                row_plot(row, right + px, color);
+                row_plot(row, left - px, color);
+            }
+        }
+        if (px == d) {
+            extent = max_i16(extent, py);
+            if (plot) {
+                row_plot(row, right + py, color);
+                row_plot(row, left - py, color);
+            }
+        }
+
+        if (f < 0) {
+            f += 2 * px + 3;
+        } else {
+            f += 2 * (px - py) + 5;
+            py--;
+        }
+        px++;
+    }
+    return extent;
+}
+
+// Same pixels as draw_round_rect()/fill_round_rect(). When the box is no taller
+// than both radii a row can belong to the top and the bottom corners at once.
+static void rasterize_round_rect(const dl_command_t* cmd, int16_t y, const dl_row_t* row) {
+    uint16_t color = row->palette[cmd->fg];
+    bool filled = cmd->flags & DL_FLAG_FILLED;
+    int16_t r = cmd->radius;
+    int16_t right_edge = cmd->x + cmd->w - 1;
+    int16_t bottom_edge = cmd->y + cmd->h - 1;
+    int16_t left = cmd->x + r;
+    int16_t right = right_edge - r;
+    int16_t top = cmd->y + r;
+    int16_t bottom = bottom_edge - r;
+
+    if (y >= top && y <= bottom) {
+        if (filled || y == cmd->y || y == bottom_edge) {
+            row_span(row, cmd->x, right_edge, color);
+        } else {
+            row_plot(row, cmd->x, color);
+            row_plot(row, right_edge, color);
+        }
+        return;
+    }
+
+    if (!filled && (y == cmd->y || y == bottom_edge)) {
+        row_span(row, left, right, color);
+    }
+
+    int16_t extent = -1;
+    if (y <= top) {
+        extent = max_i16(extent, corner_row(row, r, top - y, left, right, color, !filled));
+    }
+    if (y >= bottom) {
+        extent = max_i16(extent, corner_row(row, r, y - bottom, left, right, color, !filled));
+    }
+
+    if (filled && extent >= 0) {
+        row_span(row, left - extent, right + extent, color);
+    }
+}
+
+// Bresenham from the row cursor; rows are usually asked for in order, going back restarts the line
+static void rasterize_line(dl_command_t* cmd, int16_t y, const dl_row_t* row) {
+    uint16_t color = row->palette[cmd->fg];
+    int16_t x1 = cmd->line.x1;
+    int16_t y1 = cmd->line.y1;
+    int16_t dx = (x1 > cmd->x) ? (x1 - cmd->x) : (cmd->x - x1);
+    int16_t dy = cmd->y - y1;
+    int16_t sx = (cmd->x < x1) ? 1 : -1;
+
+    if (y < cmd->line.cy) {
+        cmd->line.cx = cmd->x;
+        cmd->line.cy = cmd->y;
+        cmd->line.err = dx + dy;
+    }
+
+    int16_t cx = cmd->line.cx;
+    int16_t cy = cmd->line.cy;
+    int32_t err = cmd->line.err;
+    bool in_row = false;
+
+    for (;;) {
+        if (cy == y) {
+            if (!in_row) {
+                // Keep the start of this row in case it is sent again
+                cmd->line.cx = cx;
+                cmd->line.cy = cy;
+                cmd->line.err = err;
+                in_row = true;
+            }
+            row_plot(row, cx, color);
+        } else if (cy > y) {
+            cmd->line.cx = cx;
+            cmd->line.cy = cy;
+            cmd->line.err = err;
+            return;
+        }
+        if (cx == x1 && cy == y1) return;
+
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            cx += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            cy++;
+        }
+    }
+}
+
+// One RLE row: runs alternate bg/fg from bg; returns the start of the next row
+static const uint8_t* rle_row(const uint8_t* data, uint16_t width, const dl_row_t* row, int16_t x,
+                              uint16_t fg, uint16_t bg) {
+    uint16_t col = 0;
+    bool foreground = false;
+
+    while (col < width) {
+        uint16_t run = *data++;
+        if (run > width - col) run = width - col;
+        if (run && row) {
+            row_span(row, x + col, x + col + run - 1, foreground ? fg : bg);
+        }
+        col += run;
+        foreground = !foreground;
+    }
+    return data;
+}
+
+static void rasterize_image(dl_command_t* cmd, int16_t y, const dl_row_t* row) {
+    uint16_t fg = row->palette[cmd->fg];
+    uint16_t bg = row->palette[cmd->bg];
+    uint16_t image_row = y - cmd->y;
+
+    if (cmd->flags & DL_FLAG_RLE) {
+        if (image_row < cmd->image.cursor_row) {
+            cmd->image.cursor = cmd->image.data;
+            cmd->image.cursor_row = 0;
+        }
+        while (cmd->image.cursor_row < image_row) {
+            cmd->image.cursor = rle_row(cmd->image.cursor, cmd->w, NULL, 0, 0, 0);
+            cmd->image.cursor_row++;
+        }
+        cmd->image.cursor = rle_row(cmd->image.cursor, cmd->w, row, cmd->x, fg, bg);
+        cmd->image.cursor_row++;
+        return;
+    }
+
+    const uint8_t* bits = cmd->image.data + image_row * ((cmd->w + 7) / 8);
+    for (int16_t x = row->x0; x <= row->x1; ++x) {
+        uint16_t col = x - cmd->x;
+        row->out[x - row->origin] = (bits[col / 8] & (0x80 >> (col % 8))) ? fg : bg;
+    }
+}
+
+static void rasterize_text(const display_list_t* list, const dl_command_t* cmd, int16_t y, const dl_row_t* row) {
+    const font_def_t* font = cmd->text.font;
+    const uint16_t* glyphs = &list->glyphs[cmd->text.offset];
+    uint16_t pitch = font->width + cmd->text.spacing;
+    uint16_t glyph_row = y - cmd->y;
+    uint16_t fg = row->palette[cmd->fg];
+    uint16_t bg = row->palette[cmd->bg];
+
+    // Glyphs left of the row clip are skipped whole
+    for (uint16_t i = (row->x0 - cmd->x) / pitch; i < cmd->text.length; ++i) {
+        int16_t gx = cmd->x + i * pitch;
+        if (gx > row->x1) break;
+
+        int16_t first = max_i16(row->x0 - gx, 0);
+        int16_t last = min_i16(row->x1 - gx, font->width - 1);
+        uint16_t* out = &row->out[gx - row->origin];
+        uint16_t glyph_index = glyphs[i];
+
+        if (cmd->flags & DL_FLAG_AA) {
+            uint8_t bpp = font->aa_bpp;
+            uint8_t per_byte = 8 / bpp;
+            uint16_t stride = (font->width + per_byte - 1) / per_byte;
+            const uint8_t* glyph = &font->aa_data[(glyph_index * font->height + glyph_row) * stride];
+
+            for (int16_t col = first; col <= last; ++col) {
+                uint8_t shift = (per_byte - 1 - (col % per_byte)) * bpp;
+                uint8_t level = (glyph[col / per_byte] >> shift) & ((1 << bpp) - 1);
+                uint8_t index = cmd->text.levels[level / 2] >> ((level % 2) ? 0 : 4);
+                out[col] = row->palette[index & 0x0F];
+            }
+        } else {
+            uint16_t bits = font->data[glyph_index * font->height + glyph_row];
+            for (int16_t col = first; col <= last; ++col) {
+                out[col] = (bits & (0x8000 >> col)) ? fg : bg;
+            }
+        }
+    }
+}
+
+void display_list_rasterize(uint8_t* page, uint16_t y, uint16_t x0, uint16_t x1,
+                            const uint16_t* palette, uint16_t* out) {
+    display_list_t* list = (display_list_t*)page;
+
+    // Root background under everything, as a cleared framebuffer would be
+    uint16_t background = palette[DISPLAY_PALETTE_BG];
+    for (uint16_t x = x0; x <= x1; ++x) {
+        out[x - x0] = background;
+    }
+
+    const uint32_t* band = list->bands[y / DL_BAND_HEIGHT];
+    for (uint8_t word = 0; word < DL_BAND_WORDS; ++word) {
+        for (uint32_t pending = band[word]; pending; pending &= pending - 1) {
+            dl_command_t* cmd = &list->commands[word * 32 + __builtin_ctz(pending)];
+            if (y < cmd->clip.y0 || y > cmd->clip.y1) continue;
+
+            dl_row_t row = {
+                .out = out,
+                .origin = x0,
+                .x0 = max_i16(x0, cmd->clip.x0),
+                .x1 = min_i16(x1, cmd->clip.x1),
+                .palette = palette,
+            };
+            if (row.x0 > row.x1) continue;
+
+            switch (cmd->type) {
+            case DL_FILL:
+                row_span(&row, row.x0, row.x1, palette[cmd->fg]);
+                break;
+            case DL_ROUND_RECT:
+                rasterize_round_rect(cmd, y, &row);
+                break;
+            case DL_LINE:
+                rasterize_line(cmd, y, &row);
+                break;
+            case DL_IMAGE:
+                rasterize_image(cmd, y, &row);
+                break;
+            case DL_TEXT:
+                rasterize_text(list, cmd, y, &row);
+                break;
+            }
+        }
+    }
+}
+
+#endif /* ILI9341_DISPLAY_LIST */
@@ -0,0 +1,35 @@
+#ifndef _LAYOUT_DISPLAY_LIST_H_
+#define _LAYOUT_DISPLAY_LIST_H_
+
+#include <stdint.h>
+#include "fonts.h"
+
+/*
+ * Display list pages (ILI9341_DISPLAY_LIST). A page holds the drawing commands
+ * of one frame instead of its pixels: fills, rounded rectangles, lines, images
+ * and text runs, each clipped when recorded and listed in every 8 row band it
+ * touches. Scanout calls display_list_rasterize() for each row it sends, which
+ * paints the root background and then the commands of that band in recording
+ * order, straight into the RGB565 line buffer.
+ *
+ * In this mode the primitives of layout_primitives.h record into the page, so
+ * elements and widgets draw the same way with or without a framebuffer.
+ */
+
+#if ILI9341_DISPLAY_LIST
+// Empty the page before the frame is recorded
+void display_list_begin(uint8_t* page);
+// Run of `length` glyphs of `font` from (x, y). `levels` maps the coverage levels
+// of an anti-aliased font to palette indices; NULL draws the 1bpp glyphs in fg/bg.
+// Returns the width of the run in pixels.
+uint16_t display_list_text(uint8_t* page, int16_t x, int16_t y, const uint16_t* glyphs, uint8_t length,
+                           const font_def_t* font, uint8_t spacing, uint8_t fg, uint8_t bg,
+                           const uint8_t* levels);
+// Commands that did not fit the page since display_list_begin()
+uint16_t display_list_dropped(const uint8_t* page);
+// Scanline source for the display driver, see display_scanline_t
+void display_list_rasterize(uint8_t* page, uint16_t y, uint16_t x0, uint16_t x1,
+                            const uint16_t* palette, uint16_t* out);
+#endif
+
+#endif /* _LAYOUT_DISPLAY_LIST_H_ */
@@ -24,12 +24,20 @@ static const uint8_t* layout_entry_base;
 static const layout_info_entry_t* layout_info_table;
 // static const placeholder_info_table_t* placeholder_info_table;
 
+// Image table (after the layout table) and the RLE data that follows it
+static uint32_t image_count;
+static const image_info_entry_t* image_info_table;
+static const uint8_t* image_data_start;
+
 // Defaut script's values
 static default_info_t root_info;
 
 // Current layout content
 static char prepared_layout[RENDERED_LAYOUT_MAX_SIZE];
 
+// Hash of the id of the current layout
+static uint32_t prepared_layout_id;
+
 /* ----------------- Function Declarations --------------------- */
 static void execute_layout(string_buffer_t* str);
 static bool extract_layout_id(string_buffer_t* buffer, string_buffer_t* layout_id_out);
@@ -119,6 +127,17 @@ void initialize_layout_binary_info(void) {
         return;
     }
 
+    // Optional image table, 4-byte aligned after the layout table
+    uint32_t image_table_offset = (total_size + 3) & ~0x03;
+    if (SCRIPT_DATA_BASE + image_table_offset + sizeof(uint32_t) <= layout_data_end) {
+        image_count      = *((uint32_t*)(SCRIPT_DATA_BASE + image_table_offset));
+        image_info_table = (const image_info_entry_t*)(SCRIPT_DATA_BASE + image_table_offset + sizeof(uint32_t));
+        image_data_start = (const uint8_t*)&image_info_table[image_count];
+        if (image_data_start > layout_data_end) {
+            image_count = 0; // Malformed table
+        }
+    }
+
     // Proceed to extract layout root information
     extract_root_info();
 }
@@ -191,6 +210,19 @@ uint8_t* get_prepared_layout(void) {
     return  (uint8_t*)prepared_layout;
 }
 
+uint32_t get_prepared_layout_id(void) {
+    return prepared_layout_id;
+}
+
+const image_info_entry_t* get_image_info(uint8_t index, const uint8_t** data) {
+    if (index >= image_count || !image_info_table) {
+        return NULL;
+    }
+
+    *data = image_data_start + image_info_table[index].offset;
+    return &image_info_table[index];
+}
+
 default_info_t* get_root_info(void) {
     return &root_info;
 }
@@ -246,9 +278,11 @@ int parse_field(const uint8_t* content, const char* key, void* value, size_t val
         case FIELD_TYPE_UINT16:
             if (value_size != sizeof(uint16_t)) return -1;
             {
-                uint16_t val = 0;
-                result = sscanf(found, " %hu", &val);
-                if (result > 0) *(uint16_t*)value = val;
+                // Base 0 so colors written as 0xRRGB parse as well as decimal values
+                char* end = NULL;
+                unsigned long val = strtoul(found, &end, 0);
+                result = (end != found) ? 1 : 0;
+                if (result > 0) *(uint16_t*)value = (uint16_t)val;
             }
             break;
         default:
@@ -258,11 +292,6 @@ int parse_field(const uint8_t* content, const char* key, void* value, size_t val
     return (result > 0) ? 1 : 0; // Success if parsed
 }
 
-// Helper: convert 16-bit value to RGB565
-uint16_t swap_byte(uint16_t value) {
-    return (value >> 8) | (value << 8);
-}
-
 static void execute_layout(string_buffer_t* str) {
     string_buffer_t layout_id;
     placeholder_pair_t pairs[MAX_PLACEHOLDERS];
@@ -302,8 +331,8 @@ static void extract_root_info(void) {
     uint16_t index = get_display_data_bank_index();
     display_info_t* display_info = (display_info_t*)read_from_databank(index);
 
-    display_info->fg_color = (root_info.color == -1) ? DEFAULT_FG_COLOR : swap_byte(root_info.color);
-    display_info->bg_color = (root_info.color == -1) ? DEFAULT_BG_COLOR : swap_byte(root_info.bg_color);
+    display_info->palette[DISPLAY_PALETTE_FG] = (root_info.color == -1) ? DEFAULT_FG_COLOR : root_info.color;
+    display_info->palette[DISPLAY_PALETTE_BG] = (root_info.color == -1) ? DEFAULT_BG_COLOR : root_info.bg_color;
 
     xEventGroupSetBits(display_event, DISPLAY_EVENT_UPDATE);
 }
@@ -385,6 +414,7 @@ static bool extract_layout_content(string_buffer_t* id) {
 
     memcpy(prepared_layout, layout_src, layout_size);
     prepared_layout[layout_size] = '\0';
+    prepared_layout_id = hash;
 
     return true;
 }
@@ -12,8 +12,8 @@
 #define MAX_NAME_LEN     32
 #define MAX_VALUE_LEN    32
 
-#define DEFAULT_FG_COLOR    (0x8ad6)
-#define DEFAULT_BG_COLOR    (0xae25)
+#define DEFAULT_FG_COLOR    (0xd68a)
+#define DEFAULT_BG_COLOR    (0x25ae)
 
 typedef struct {
     string_buffer_t name;
@@ -33,9 +33,10 @@ void initialize_layout_binary_info(void);
 void parse_layout(uint8_t* str, uint16_t length);
 bool get_next_script_line(string_buffer_t* script, string_buffer_t* line_out);
 uint8_t* get_prepared_layout(void);
+uint32_t get_prepared_layout_id(void);
+const image_info_entry_t* get_image_info(uint8_t index, const uint8_t** data);
 default_info_t* get_root_info(void);
 int16_t parse_field_u16(const uint8_t* content, const char* key);
 uint8_t parse_field_u8(const uint8_t* content, const char* key);
 int parse_field(const uint8_t* content, const char* key, void* value, size_t value_size, field_type_t type);
-uint16_t swap_byte(uint16_t value);
 #endif /* _LAYOUT_BINARY_H_ */
\ No newline at end of file
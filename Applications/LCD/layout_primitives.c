@@ -0,0 +1,359 @@
+#include "main.h"
+#include "layout_primitives.h"
+
+#define PIXELS_PER_WORD     (32 / ILI9341_BITS_PER_PIXEL)
+
+// Palette index replicated into every pixel slot of a word (index * 0x..1111)
+#define FILL_PATTERN(color) (((uint32_t)(color) & ILI9341_PIXEL_MASK) * (0xFFFFFFFFu / ILI9341_PIXEL_MASK))
+
+// Pixel 0 of a word is in the top bits of its big-endian view; __REV maps it to memory order
+static inline void write_masked_word(uint32_t* word, uint32_t mask_be, uint32_t value) {
+    uint32_t mask = __REV(mask_be);
+    *word = (*word & ~mask) | (value & mask);
+}
+
+static inline int16_t min_i16(int16_t a, int16_t b) { return (a < b) ? a : b; }
+static inline int16_t max_i16(int16_t a, int16_t b) { return (a > b) ? a : b; }
+
+page_geometry_t page_geometry = {ILI9341_WIDTH, ILI9341_HEIGHT, ILI9341_BYTES_PER_ROW};
+
+// Clip stack, the bottom entry is the whole screen
+static clip_rect_t clip_stack[CLIP_STACK_DEPTH] = {
+    {0, 0, ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1},
+};
+static uint8_t clip_depth = 0;
+static const clip_rect_t* clip = &clip_stack[0];
+
+void set_page_geometry(uint16_t width, uint16_t height, uint16_t stride) {
+    page_geometry.width = width;
+    page_geometry.height = height;
+    page_geometry.stride = stride;
+
+    clip_stack[0].x1 = width - 1;
+    clip_stack[0].y1 = height - 1;
+    clip_reset();
+}
+
+void clip_reset(void) {
+    clip_depth = 0;
+    clip = &clip_stack[0];
+}
+
+void clip_push(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    if (clip_depth + 1 >= CLIP_STACK_DEPTH) return;
+
+    // Nested clips never reach outside their parent; an empty clip rejects everything
+    clip_rect_t* top = &clip_stack[clip_depth + 1];
+    top->x0 = max_i16(x0, clip->x0);
+    top->y0 = max_i16(y0, clip->y0);
+    top->x1 = min_i16(x1, clip->x1);
+    top->y1 = min_i16(y1, clip->y1);
+
+    clip = &clip_stack[++clip_depth];
+}
+
+void clip_pop(void) {
+    if (clip_depth == 0) return;
+    clip = &clip_stack[--clip_depth];
+}
+
+const clip_rect_t* clip_current(void) {
+    return clip;
+}
+
+bool clip_box(int16_t* x0, int16_t* y0, int16_t* x1, int16_t* y1) {
+    *x0 = max_i16(*x0, clip->x0);
+    *y0 = max_i16(*y0, clip->y0);
+    *x1 = min_i16(*x1, clip->x1);
+    *y1 = min_i16(*y1, clip->y1);
+    return (*x0 <= *x1) && (*y0 <= *y1);
+}
+
+#if !ILI9341_DISPLAY_LIST
+void draw_pixel(uint8_t* fb, int16_t x, int16_t y, uint8_t color) {
+    if (x < clip->x0 || x > clip->x1 || y < clip->y0 || y > clip->y1) return;
+
+    put_pixel(fb, x, y, color);
+}
+
+// 1bpp: the clipped columns land in at most three page bytes
+void draw_mono_row(uint8_t* fb, int16_t x, int16_t y, uint16_t bits,
+                   uint8_t first, uint8_t last, uint8_t fg, uint8_t bg) {
+#if ILI9341_BITS_PER_PIXEL == 1
+    if (fg == bg) {
+        bits = fg ? 0xFFFF : 0x0000;
+    } else if (!fg) {
+        bits = ~bits;
+    }
+
+    int16_t start = x + first;
+    uint8_t offset = start % 8;
+    uint16_t mask = (uint16_t)(0xFFFF << (15 - last)) & (uint16_t)(0xFFFF >> first);
+    uint32_t value = ((uint32_t)(uint16_t)(bits << first)) << (8 - offset);
+    uint32_t window = ((uint32_t)(uint16_t)(mask << first)) << (8 - offset);
+    uint8_t* dst = &fb[y * page_geometry.stride + (start / 8)];
+
+    for (uint8_t i = 0; i < 3; ++i) {
+        uint8_t m = (uint8_t)(window >> (16 - 8 * i));
+        if (m) {
+            dst[i] = (dst[i] & ~m) | ((uint8_t)(value >> (16 - 8 * i)) & m);
+        }
+    }
+#else
+    for (uint8_t col = first; col <= last; ++col) {
+        put_pixel(fb, x + col, y, (bits & (0x8000 >> col)) ? fg : bg);
+    }
+#endif
+}
+
+// Horizontal span [x0, x1] on row y: masked head/tail words, plain word stores in between
+void fill_span(uint8_t* fb, int16_t x0, int16_t x1, int16_t y, uint8_t color) {
+    if (y < clip->y0 || y > clip->y1) return;
+    if (x0 > x1) {
+        int16_t t = x0; x0 = x1; x1 = t;
+    }
+    x0 = max_i16(x0, clip->x0);
+    x1 = min_i16(x1, clip->x1);
+    if (x0 > x1) return;
+
+    // Words are counted from the page start: a row need not start on a word (240 px at 1bpp)
+    uint32_t* words = (uint32_t*)fb;
+    uint32_t p0 = (uint32_t)y * page_geometry.width + x0;
+    uint32_t p1 = (uint32_t)y * page_geometry.width + x1;
+    uint32_t value = FILL_PATTERN(color);
+    uint32_t first = p0 / PIXELS_PER_WORD;
+    uint32_t last = p1 / PIXELS_PER_WORD;
+    uint32_t head = 0xFFFFFFFFu >> ((p0 % PIXELS_PER_WORD) * ILI9341_BITS_PER_PIXEL);
+    uint32_t tail = 0xFFFFFFFFu << ((PIXELS_PER_WORD - 1 - (p1 % PIXELS_PER_WORD)) * ILI9341_BITS_PER_PIXEL);
+
+    if (first == last) {
+        write_masked_word(&words[first], head & tail, value);
+        return;
+    }
+
+    write_masked_word(&words[first], head, value);
+    for (uint32_t w = first + 1; w < last; ++w) {
+        words[w] = value;
+    }
+    write_masked_word(&words[last], tail, value);
+}
+
+// Bresenham line, with the horizontal case routed to the span filler
+void draw_line(uint8_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color) {
+    if (y0 == y1) {
+        fill_span(fb, x0, x1, y0, color);
+        return;
+    }
+
+    int16_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+    int16_t dy = (y1 > y0) ? (y0 - y1) : (y1 - y0);
+    int16_t sx = (x0 < x1) ? 1 : -1;
+    int16_t sy = (y0 < y1) ? 1 : -1;
+    int32_t err = dx + dy;
+
+    for (;;) {
+        draw_pixel(fb, x0, y0, color);
+        if (x0 == x1 && y0 == y1) break;
+
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void draw_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t color) {
+    if (w == 0 || h == 0) return;
+
+    int16_t x1 = x + w - 1;
+    int16_t y1 = y + h - 1;
+
+    fill_span(fb, x, x1, y, color);
+    fill_span(fb, x, x1, y1, color);
+    for (int16_t row = y + 1; row < y1; ++row) {
+        draw_pixel(fb, x, row, color);
+        draw_pixel(fb, x1, row, color);
+    }
+}
+
+void fill_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t color) {
+    if (w == 0 || h == 0) return;
+
+    int16_t y0 = max_i16(y, clip->y0);
+    int16_t y1 = min_i16(y + h - 1, clip->y1);
+
+    // Full-width blocks are contiguous in memory
+    if (clip->x0 == 0 && clip->x1 == page_geometry.width - 1 && x <= 0 && x + w >= page_geometry.width) {
+        if (y0 <= y1) {
+            memset(&fb[y0 * page_geometry.stride], (uint8_t)FILL_PATTERN(color),
+                   (y1 - y0 + 1) * page_geometry.stride);
+        }
+        return;
+    }
+
+    for (int16_t row = y0; row <= y1; ++row) {
+        fill_span(fb, x, x + w - 1, row, color);
+    }
+}
+
+static uint16_t clamp_radius(uint16_t w, uint16_t h, uint16_t r) {
+    uint16_t limit = ((w < h) ? w : h) / 2;
+    return (r > limit) ? limit : r;
+}
+
+// Midpoint circle walk over the four corners of a rounded rectangle
+void draw_round_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint8_t color) {
+    if (w == 0 || h == 0) return;
+
+    r = clamp_radius(w, h, r);
+    if (r == 0) {
+        draw_rect(fb, x, y, w, h, color);
+        return;
+    }
+
+    int16_t left = x + r;
+    int16_t right = x + w - 1 - r;
+    int16_t top = y + r;
+    int16_t bottom = y + h - 1 - r;
+
+    fill_span(fb, left, right, y, color);
+    fill_span(fb, left, right, y + h - 1, color);
+    for (int16_t row = top; row <= bottom; ++row) {
+        draw_pixel(fb, x, row, color);
+        draw_pixel(fb, x + w - 1, row, color);
+    }
+
+    int16_t px = 0;
+    int16_t py = r;
+    int32_t f = 1 - r;
+
+    while (px <= py) {
+        draw_pixel(fb, right + px, top - py, color);
+        draw_pixel(fb, right + py, top - px, color);
+        draw_pixel(fb, left - px, top - py, color);
+        draw_pixel(fb, left - py, top - px, color);
+        draw_pixel(fb, right + px, bottom + py, color);
+        draw_pixel(fb, right + py, bottom + px, color);
+        draw_pixel(fb, left - px, bottom + py, color);
+        draw_pixel(fb, left - py, bottom + px, color);
+
+        if (f < 0) {
+            f += 2 * px + 3;
+        } else {
+            f += 2 * (px - py) + 5;
+            py--;
+        }
+        px++;
+    }
+}
+
+void fill_round_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint8_t color) {
+    if (w == 0 || h == 0) return;
+
+    r = clamp_radius(w, h, r);
+    if (r == 0) {
+        fill_rect(fb, x, y, w, h, color);
+        return;
+    }
+
+    int16_t left = x + r;
+    int16_t right = x + w - 1 - r;
+    int16_t top = y + r;
+    int16_t bottom = y + h - 1 - r;
+
+    fill_rect(fb, x, top, w, bottom - top + 1, color);
+
+    int16_t px = 0;
+    int16_t py = r;
+    int32_t f = 1 - r;
+
+    while (px <= py) {
+        fill_span(fb, left - px, right + px, top - py, color);
+        fill_span(fb, left - px, right + px, bottom + py, color);
+        fill_span(fb, left - py, right + py, top - px, color);
+        fill_span(fb, left - py, right + py, bottom + px, color);
+
+        if (f < 0) {
+            f += 2 * px + 3;
+        } else {
+            f += 2 * (px - py) + 5;
+            py--;
+        }
+        px++;
+    }
+}
+
+// Runs alternate background and foreground, starting with background; a run of
+// 255 followed by a zero-length run continues the same color
+void draw_rle_image(uint8_t* fb, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                    const uint8_t* data, uint8_t fg, uint8_t bg) {
+    for (uint16_t row = 0; row < height; ++row) {
+        uint16_t col = 0;
+        bool foreground = false;
+
+        while (col < width) {
+            uint16_t run = *data++;
+            if (run > width - col) run = width - col;
+            if (run) {
+                fill_span(fb, x + col, x + col + run - 1, y + row, foreground ? fg : bg);
+            }
+            col += run;
+            foreground = !foreground;
+        }
+    }
+}
+
+void draw_bitmap(uint8_t* fb, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                 const uint8_t* data, uint8_t fg, uint8_t bg) {
+    uint16_t stride = (width + 7) / 8;
+
+    for (uint16_t row = 0; row < height; ++row, data += stride) {
+#if ILI9341_BITS_PER_PIXEL == 1
+        // Byte aligned and unclipped: source bytes are page bytes, inverted if the colors are
+        if ((x % 8) == 0 && x >= clip->x0 && x + width - 1 <= clip->x1 && fg != bg &&
+            y + row >= clip->y0 && y + row <= clip->y1) {
+            uint8_t* dst = &fb[(y + row) * page_geometry.stride + (x / 8)];
+            uint8_t invert = fg ? 0x00 : 0xFF;
+            uint16_t whole = width / 8;
+
+            for (uint16_t b = 0; b < whole; ++b) {
+                dst[b] = data[b] ^ invert;
+            }
+            if (width % 8) {
+                uint8_t mask = 0xFF << (8 - (width % 8));
+                dst[whole] = (dst[whole] & ~mask) | ((data[whole] ^ invert) & mask);
+            }
+            continue;
+        }
+#endif
+        for (uint16_t col = 0; col < width; ++col) {
+            bool set = data[col / 8] & (0x80 >> (col % 8));
+            draw_pixel(fb, x + col, y + row, set ? fg : bg);
+        }
+    }
+}
+
+#endif /* !ILI9341_DISPLAY_LIST */
+
+#if ILI9341_USE_ATTRIBUTE_MAP
+void fill_tiles(uint8_t* attributes, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t attribute) {
+    x0 = max_i16(x0, 0);
+    y0 = max_i16(y0, 0);
+    x1 = min_i16(x1, page_geometry.width - 1);
+    y1 = min_i16(y1, page_geometry.height - 1);
+    if (x0 > x1 || y0 > y1) return;
+
+    uint16_t tile_columns = page_geometry.width / ILI9341_TILE_SIZE;
+    uint16_t first_column = x0 / ILI9341_TILE_SIZE;
+    uint16_t column_count = (x1 / ILI9341_TILE_SIZE) - first_column + 1;
+
+    for (uint16_t row = y0 / ILI9341_TILE_SIZE; row <= y1 / ILI9341_TILE_SIZE; ++row) {
+        memset(&attributes[row * tile_columns + first_column], attribute, column_count);
+    }
+}
+#endif
@@ -0,0 +1,78 @@
+#ifndef _LAYOUT_PRIMITIVES_H_
+#define _LAYOUT_PRIMITIVES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Drawing primitives for the render page at ILI9341_BITS_PER_PIXEL.
+ * Pixels are packed MSB-first inside each byte, rows follow each other without
+ * padding (page_geometry.stride bytes each), and the page must be 32-bit
+ * aligned. `color` is the palette index to write. All coordinates are clipped
+ * to the top of the clip stack.
+ * With ILI9341_DISPLAY_LIST the page is a display list and the primitives
+ * record commands into it instead (layout_display_list.c).
+ */
+
+#define CLIP_STACK_DEPTH    4
+
+// Inclusive clip rectangle in screen coordinates
+typedef struct {
+    int16_t x0, y0;
+    int16_t x1, y1;
+} clip_rect_t;
+
+// Size of the render page as the display driver reports it, rotation included
+typedef struct {
+    int16_t width, height;
+    uint16_t stride;            // bytes per row
+} page_geometry_t;
+
+extern page_geometry_t page_geometry;
+
+// Take the page size of a new rotation; the clip stack is reset to the whole page
+void set_page_geometry(uint16_t width, uint16_t height, uint16_t stride);
+
+void clip_reset(void);
+void clip_push(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void clip_pop(void);
+const clip_rect_t* clip_current(void);
+// Intersect an inclusive box with the current clip; false if nothing is left
+bool clip_box(int16_t* x0, int16_t* y0, int16_t* x1, int16_t* y1);
+
+#if !ILI9341_DISPLAY_LIST
+// Pixel write without clipping, for callers that clipped the whole shape already
+static inline void put_pixel(uint8_t* fb, int16_t x, int16_t y, uint8_t color) {
+    uint8_t* byte = &fb[y * page_geometry.stride + (x / ILI9341_PIXELS_PER_BYTE)];
+    uint8_t shift = (ILI9341_PIXELS_PER_BYTE - 1 - (x % ILI9341_PIXELS_PER_BYTE)) * ILI9341_BITS_PER_PIXEL;
+    uint8_t mask = ILI9341_PIXEL_MASK << shift;
+
+    *byte = (*byte & ~mask) | ((color << shift) & mask);
+}
+
+// Columns first..last (0 = MSB) of a 16 pixel bitmap row, already clipped by the caller
+void draw_mono_row(uint8_t* fb, int16_t x, int16_t y, uint16_t bits,
+                   uint8_t first, uint8_t last, uint8_t fg, uint8_t bg);
+#endif
+
+void draw_pixel(uint8_t* fb, int16_t x, int16_t y, uint8_t color);
+void fill_span(uint8_t* fb, int16_t x0, int16_t x1, int16_t y, uint8_t color);
+void draw_line(uint8_t* fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color);
+void draw_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t color);
+void fill_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t color);
+void draw_round_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint8_t color);
+void fill_round_rect(uint8_t* fb, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint8_t color);
+
+// Row RLE image (see tml2obj.py), each run becomes one span: cost follows the compressed size
+void draw_rle_image(uint8_t* fb, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                    const uint8_t* data, uint8_t fg, uint8_t bg);
+// 1bpp bitmap rows, MSB first and padded to whole bytes
+void draw_bitmap(uint8_t* fb, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                 const uint8_t* data, uint8_t fg, uint8_t bg);
+
+#if ILI9341_USE_ATTRIBUTE_MAP
+// Set the attribute of every tile touching the inclusive box [x0, x1] x [y0, y1]
+void fill_tiles(uint8_t* attributes, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t attribute);
+#endif
+
+#endif /* _LAYOUT_PRIMITIVES_H_ */
@@ -2,24 +2,183 @@
 #include "script_types.h"
 #include "layout_parser.h"
 #include "layout_renderer.h"
+#include "layout_primitives.h"
+#include "layout_widgets.h"
+#include "layout_display_list.h"
+#include "layout_timeline.h"
+#include "layout_scene.h"
 #include "fonts.h"
+#ifdef LAYOUT_GLYPH_PROFILE
+#include "cycle_counter.h"
+#endif
 
 #define MAX_LINES 10
-#define MAX_CHAR_PER_LINE 50
+#define MAX_WIDGETS 4
 
 static ALIGN align;
 static AREA area;
 static uint8_t* rendering_layout;
 static string_buffer_t script;
 static string_buffer_t line;
-static uint8_t total, current;
 static uint16_t x_pos, y_pos;
 static uint16_t width, height, color, bg_color;
 static char text[50];
 static font_type_t font;
-
-static const char* line_starts[MAX_LINES];
-static size_t line_lengths[MAX_LINES];
+static uint8_t fill;
+static uint16_t radius;
+static uint16_t line_x1, line_y1, line_x2, line_y2;
+static uint8_t widget_type;
+static uint8_t image_index;
+static uint16_t scroll_offset;
+
+static default_info_t layout_defaults;
+static element_type_t element;
+static bool area_latched;
+static bool has_background;
+static bool has_color;
+static bool has_scroll;
+static uint16_t area_color, area_bg_color;
+static uint8_t* render_buff;
+#if ILI9341_USE_ATTRIBUTE_MAP
+static uint8_t* render_attributes;
+#endif
+#if !ILI9341_DISPLAY_LIST
+static uint32_t* render_rows;       // row-valid bitmap of the render page
+#endif
+
+// Palette entries handed out so far; background and foreground come from the root
+static uint8_t palette_used = 2;
+
+// A color tween owns one entry and rewrites it every frame, so in-between colors
+// take no entries of their own. Owned entries never match other colors, and the
+// other colors of a tweened element take the nearest entry rather than a new one.
+#define PALETTE_NONE UINT8_MAX
+static uint32_t palette_tween_entries;  // bit per owned entry
+static uint8_t tween_fg_entry = PALETTE_NONE, tween_bg_entry = PALETTE_NONE;
+static bool palette_frozen;
+
+#if ILI9341_BITS_PER_PIXEL > 1
+// Intermediate tones between background and foreground for anti-aliased text.
+// Each tone takes a palette entry, so smaller palettes get fewer.
+#if ILI9341_BITS_PER_PIXEL == 4
+#define TEXT_BLEND_TONES 3
+#else
+#define TEXT_BLEND_TONES 1
+#endif
+
+// Coverage level to palette index for the current text colors
+static uint8_t blend_lut[16];
+#if ILI9341_BITS_PER_PIXEL == 4 && !ILI9341_DISPLAY_LIST
+// Two 4bpp coverage pixels to two framebuffer pixels, one load per byte
+static uint8_t blend_byte_lut[256];
+#endif
+static uint32_t blend_key = UINT32_MAX;
+static uint8_t blend_bpp;
+#endif
+
+#ifdef LAYOUT_GLYPH_PROFILE
+static uint32_t glyph_count, glyph_cycles_1bpp, glyph_cycles_aa;
+#endif
+
+// What a widget looked like when last drawn, so the next frame can update it in place
+typedef struct {
+    bool valid;
+    uint8_t type;
+    uint32_t layout_id;
+    int16_t x, y;
+    uint16_t width, height;
+    uint8_t fg_index, bg_index;
+    uint8_t props[WIDGET_PROPS_MAX];
+} widget_instance_t;
+
+static widget_instance_t widget_instances[MAX_WIDGETS];
+static widget_instance_t* widget_slot;  // instance of the current widget
+static uint8_t widget_count;
+static bool area_cleared;
+
+// Parts of the area drawn this frame. A scrolled area keeps its content in a
+// ring of panel columns, so a strip of content columns lands `shift` pixels away.
+// Animation frames cut the strips further down to the damage rectangles.
+typedef struct {
+    clip_rect_t rect;
+    int16_t shift;
+} area_strip_t;
+
+#define AREA_STRIPS_MAX (2 * DIRTY_REGION_MAX_RECTS)
+
+static area_strip_t area_strips[AREA_STRIPS_MAX];
+static uint8_t area_strip_count;
+static int16_t area_shift;    // shift of the strip being drawn
+static bool area_scrolls;
+
+// Scrolled area of the last frame; the panel has a single scroll region
+typedef struct {
+    bool valid;
+    uint32_t layout_id;
+    uint32_t content;         // hash of the area script after its own properties
+    AREA area;
+    uint16_t color, bg_color;
+    uint16_t offset;
+} scroll_state_t;
+
+static scroll_state_t scroll_state;
+static bool scroll_claimed;
+
+// Active band of the layout (`band`, `idle`): the panel only shows these columns
+typedef struct {
+    uint16_t start;
+    uint16_t size;            // 0: the whole screen
+    bool idle;
+} layout_band_t;
+
+static layout_band_t layout_band;   // parsed from the script
+static layout_band_t sent_band;     // handed to the driver with the last frame
+
+// The script is parsed into scene nodes, frames walk the nodes. A full frame
+// draws all of them; other frames measure what changed since the last frame,
+// then redraw only inside the damage.
+typedef enum {
+    RENDER_PASS_PARSE,
+    RENDER_PASS_FULL,
+    RENDER_PASS_MEASURE,
+    RENDER_PASS_DAMAGE,
+} render_pass_t;
+
+static render_pass_t render_pass;
+static dirty_region_t damage;
+static scene_node_t* current_node;  // node being walked
+static bool element_in_place;       // widget updating itself outside the damage
+
+// Tweens of the current element
+static scene_tween_t element_tweens[TWEENS_PER_ELEMENT];
+static uint8_t element_tween_count;
+
+// Hash of the script of the current area, tells a scrolled area its content changed
+static uint32_t area_content;
+
+// The timeline starts over whenever another layout is shown
+static bool timeline_started;
+static uint32_t timeline_layout_id;
+static TickType_t timeline_origin;
+static uint32_t frame_time;       // ms into the timeline, the same for both passes of a frame
+static bool timeline_running;
+static bool render_pending;       // an update is parsed but found no page to be drawn in
+
+// Text decoded from UTF-8 to glyphs of one font. Measuring and drawing an element
+// both start from the text, the decode of the last one is kept for the other.
+typedef struct {
+    const font_def_t* font;
+    char source[sizeof(text)];
+    uint16_t space;                 // glyph of ' ', where lines may break
+    uint8_t count;
+    uint16_t glyphs[sizeof(text)];
+} text_glyphs_t;
+
+static text_glyphs_t decoded;
+
+// Lines as glyph runs of `decoded`
+static uint8_t line_starts[MAX_LINES];
+static uint8_t line_lengths[MAX_LINES];
 
 // Define field mappings
 static const field_mapping_t field_mappings[] = {
@@ -32,99 +191,490 @@ static const field_mapping_t field_mappings[] = {
     {"text", text, sizeof(text), FIELD_TYPE_STRING},
     {"align", &align.alignment, sizeof(uint8_t), FIELD_TYPE_UINT8},
     {"font", &font, sizeof(uint8_t), FIELD_TYPE_UINT8},
-    {"align", &total, sizeof(uint8_t), FIELD_TYPE_UINT8},
-    {"align", &current, sizeof(uint8_t), FIELD_TYPE_UINT8},
+    {"fill", &fill, sizeof(uint8_t), FIELD_TYPE_UINT8},
+    {"radius", &radius, sizeof(uint16_t), FIELD_TYPE_UINT16},
+    {"x1", &line_x1, sizeof(uint16_t), FIELD_TYPE_UINT16},
+    {"y1", &line_y1, sizeof(uint16_t), FIELD_TYPE_UINT16},
+    {"x2", &line_x2, sizeof(uint16_t), FIELD_TYPE_UINT16},
+    {"y2", &line_y2, sizeof(uint16_t), FIELD_TYPE_UINT16},
+    {"image", &image_index, sizeof(uint8_t), FIELD_TYPE_UINT8},
+    {"scroll", &scroll_offset, sizeof(uint16_t), FIELD_TYPE_UINT16},
 };
 
 static const size_t num_mappings = sizeof(field_mappings) / sizeof(field_mapping_t);
 
 static bool script_ready = false;
 
+// Rotation asked for and the one the render page is drawn at. A new page size
+// makes the next frame a full one, retained pixels no longer line up.
+static display_rotation_t layout_rotation;
+static display_rotation_t page_rotation;
+static bool geometry_changed;
+static bool column_scroll = true;   // the panel can scroll areas at this rotation
+
 static uint8_t* get_render_screen(const display_info_t* display_info) {
     ili9341_display_buffer_t* framebuffer = (ili9341_display_buffer_t*)display_info->data;
     
-    if (framebuffer->buffer_page[framebuffer->render_page].state == ILI9341_BUFFER_STATE_IDLE) {
+    if (framebuffer->buffer_page[framebuffer->render_page].state == ILI9341_BUFFER_STATE_RENDERING) {
         return (uint8_t*)&framebuffer->buffer_page[framebuffer->render_page].data[0];
     }
 
     return NULL;
 }
 
-static void set_ready_screen(const display_info_t* display_info) {
+#if ILI9341_USE_ATTRIBUTE_MAP
+static uint8_t* get_render_attributes(const display_info_t* display_info) {
+    ili9341_display_buffer_t* framebuffer = (ili9341_display_buffer_t*)display_info->data;
+    return framebuffer->buffer_page[framebuffer->render_page].attributes;
+}
+#endif
+
+#if !ILI9341_DISPLAY_LIST
+static uint32_t* get_render_rows(const display_info_t* display_info) {
     ili9341_display_buffer_t* framebuffer = (ili9341_display_buffer_t*)display_info->data;
-    framebuffer->buffer_page[framebuffer->render_page].state = ILI9341_BUFFER_STATE_READY_TO_DISPLAY;
+    return framebuffer->buffer_page[framebuffer->render_page].row_valid;
+}
+#endif
+
+static void set_ready_screen(void) {
+    const display_driver_t* driver = get_display_driver();
+    if (driver && driver->end_frame) {
+        driver->end_frame();
+    }
+}
+
+// Report pixels written to the render page so only they are sent to the panel
+static void mark_dirty_area(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    const display_driver_t* driver = get_display_driver();
+    if (!driver || !driver->update_window || w == 0 || h == 0) {
+        return;
+    }
+
+    if (render_pass != RENDER_PASS_DAMAGE || element_in_place) {
+        driver->update_window(x, y, w, h);
+        return;
+    }
+
+    // Animation frames send their damage only, whatever else was drawn around it
+    for (uint8_t i = 0; i < damage.count; ++i) {
+        const dirty_rect_t* rect = &damage.rects[i];
+        uint16_t x0 = (x > rect->x0) ? x : rect->x0;
+        uint16_t y0 = (y > rect->y0) ? y : rect->y0;
+        uint16_t x1 = (x + w - 1 < rect->x1) ? (x + w - 1) : rect->x1;
+        uint16_t y1 = (y + h - 1 < rect->y1) ? (y + h - 1) : rect->y1;
+        if (x0 <= x1 && y0 <= y1) {
+            driver->update_window(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+        }
+    }
+}
+
+// Same as mark_dirty_area() for signed, inclusive corners, limited to the clip rectangle
+static void mark_dirty_box(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    if (!clip_box(&x0, &y0, &x1, &y1)) return;
+
+    mark_dirty_area(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+}
+
+#if !ILI9341_DISPLAY_LIST
+// Rows of the render page not drawn since it was invalidated hold stale pixels,
+// scanout shows them as background. Clear the stale rows among y0..y1 before
+// anything is drawn into them.
+static void validate_rows(int16_t y0, int16_t y1) {
+    y0 = (y0 > 0) ? y0 : 0;
+    y1 = (y1 < page_geometry.height) ? y1 : (page_geometry.height - 1);
+
+    for (int16_t row = y0; row <= y1; ++row) {
+        uint32_t* word = &render_rows[row / 32];
+        if (*word & (1u << (row % 32))) continue;
+
+#if ILI9341_USE_ATTRIBUTE_MAP
+        // First row drawn in its tile row: the tiles still have the old colors
+        if (((*word >> ((row % 32) & ~(ILI9341_TILE_SIZE - 1))) & ((1u << ILI9341_TILE_SIZE) - 1)) == 0) {
+            fill_tiles(render_attributes, 0, row, page_geometry.width - 1, row,
+                       ILI9341_ATTRIBUTE(DISPLAY_PALETTE_FG, DISPLAY_PALETTE_BG));
+        }
+#endif
+        // DISPLAY_PALETTE_BG is index 0, zero bytes are background pixels
+        memset(&render_buff[row * page_geometry.stride], DISPLAY_PALETTE_BG, page_geometry.stride);
+        *word |= 1u << (row % 32);
+    }
+}
+#endif
+
+// The whole page is redrawn: nothing of it is kept, and all of it is sent
+static void invalidate_page(void) {
+#if !ILI9341_DISPLAY_LIST
+    memset(render_rows, 0, ILI9341_ROW_VALID_WORDS * sizeof(uint32_t));
+#endif
+    mark_dirty_area(0, 0, page_geometry.width, page_geometry.height);
+}
+
+// A render page was just begun: turn it to the rotation asked for, then draw at the size
+// the driver reports for it
+static void follow_rotation(const display_info_t* display_info) {
+    const display_driver_t* driver = get_display_driver();
+    if (layout_rotation != page_rotation && driver && driver->set_rotation) {
+        driver->set_rotation(layout_rotation);
+    }
+    page_rotation = layout_rotation;
+    column_scroll = display_info->column_scroll;
+
+    if (display_info->width != page_geometry.width || display_info->height != page_geometry.height ||
+        display_info->stride != page_geometry.stride) {
+        set_page_geometry(display_info->width, display_info->height, display_info->stride);
+        geometry_changed = true;
+    }
+}
+
+// Render page of the frame being built, or NULL while scanout owns every page
+static uint8_t* acquire_render_buffer(void) {
+    uint16_t bank_index = get_display_data_bank_index();
+    const display_info_t* display_info = (display_info_t*)read_from_databank(bank_index);
+    const display_driver_t* driver = get_display_driver();
+    if (!display_info || !display_info->data || !driver || !driver->begin_frame) {
+        return NULL;
+    }
+
+    uint8_t* page = driver->begin_frame();
+    if (!page) {
+        return NULL;
+    }
+#if ILI9341_USE_ATTRIBUTE_MAP
+    render_attributes = get_render_attributes(display_info);
+#endif
+#if !ILI9341_DISPLAY_LIST
+    render_rows = get_render_rows(display_info);
+#endif
+#if ILI9341_DISPLAY_LIST
+    // Pages hold display lists, scanout rasterizes them through us
+    if (driver->set_scanline_source) {
+        driver->set_scanline_source(display_list_rasterize);
+    }
+#endif
+    follow_rotation(display_info);
+    return page;
+}
+
+// Palette entry for a TML color (RGB565). Entries are allocated on first use and
+// kept until the next whole redraw, since retained pixels keep referring to them;
+// once the palette is full the nearest entry is used. Plain 1bpp keeps the fixed
+// fg/bg roles.
+static uint8_t palette_entry(uint16_t rgb, uint8_t role) {
+#if ILI9341_BITS_PER_PIXEL == 1 && !ILI9341_USE_ATTRIBUTE_MAP
+    (void)rgb;
+    return role;
+#else
+    display_info_t* display_info = (display_info_t*)read_from_databank(get_display_data_bank_index());
+    if (!display_info) return role;
+
+    // The tweened color of the element being drawn
+    uint8_t tweened = (role == DISPLAY_PALETTE_FG) ? tween_fg_entry : tween_bg_entry;
+    if (tweened != PALETTE_NONE && display_info->palette[tweened] == rgb) return tweened;
+
+    uint8_t best = role;
+    uint32_t best_distance = UINT32_MAX;
+
+    for (uint8_t i = 0; i < palette_used; ++i) {
+        if (palette_tween_entries & (1u << i)) continue;
+        if (display_info->palette[i] == rgb) return i;
+
+        uint16_t entry = display_info->palette[i];
+        int32_t dr = (int32_t)(rgb >> 11) - (int32_t)(entry >> 11);
+        int32_t dg = (int32_t)((rgb >> 5) & 0x3F) - (int32_t)((entry >> 5) & 0x3F);
+        int32_t db = (int32_t)(rgb & 0x1F) - (int32_t)(entry & 0x1F);
+        uint32_t distance = (uint32_t)(4 * dr * dr + dg * dg + 4 * db * db);
+        if (distance < best_distance) {
+            best_distance = distance;
+            best = i;
+        }
+    }
+
+    if (!palette_frozen && palette_used < display_info->palette_size) {
+        display_info->palette[palette_used] = rgb;
+        return palette_used++;
+    }
+
+    return best;
+#endif
+}
+
+#if ILI9341_BITS_PER_PIXEL > 1 || ILI9341_USE_ATTRIBUTE_MAP
+// Entry a color tween of the current node draws its value with, taken on the
+// first frame. PALETTE_NONE once the palette is full: the value then goes
+// through palette_entry() like any other color.
+static uint8_t tween_palette_entry(uint8_t* owned, uint16_t rgb) {
+    display_info_t* display_info = (display_info_t*)read_from_databank(get_display_data_bank_index());
+    if (!display_info) return PALETTE_NONE;
+
+    if (*owned == PALETTE_NONE) {
+        if (palette_used >= display_info->palette_size) return PALETTE_NONE;
+        *owned = palette_used++;
+        palette_tween_entries |= 1u << *owned;
+    }
+    display_info->palette[*owned] = rgb;
+    return *owned;
+}
+#endif
+
+// Back to allocating after a tweened element
+static void clear_tween_colors(void) {
+#if ILI9341_BITS_PER_PIXEL > 1
+    // Its blend tables point at the owned entries
+    if (palette_frozen) {
+        blend_key = UINT32_MAX;
+    }
+#endif
+    tween_fg_entry = tween_bg_entry = PALETTE_NONE;
+    palette_frozen = false;
 }
 
-static void draw_char_1ppb(uint8_t* framebuffer, int x, int y, char character, 
-                          uint16_t font_width, uint16_t font_height, const uint16_t* font_data) {
+// Every entry is free again: only for a frame that draws every pixel
+static void reset_palette(void) {
+    palette_used = 2;
+    palette_tween_entries = 0;
+    clear_tween_colors();
+#if ILI9341_BITS_PER_PIXEL > 1
+    blend_key = UINT32_MAX;
+#endif
+    for (uint8_t i = 0; i < scene_count(); ++i) {
+        memset(scene_node(i)->palette_entries, PALETTE_NONE, sizeof(scene_node(i)->palette_entries));
+    }
+}
+
+// Pixel value to draw a color with; 1bpp pixels only select the tile fg or bg
+static uint8_t palette_index(uint16_t rgb, uint8_t role) {
+#if ILI9341_BITS_PER_PIXEL == 1
+    (void)rgb;
+    return role;
+#else
+    return palette_entry(rgb, role);
+#endif
+}
+
+// Give the tiles under an inclusive box the current colors. Tiles are 8x8, so
+// the whole tiles are reported dirty: pixels around the box change color too.
+static void color_tiles(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t fg, uint16_t bg) {
+#if ILI9341_USE_ATTRIBUTE_MAP
+    if (!render_attributes || !clip_box(&x0, &y0, &x1, &y1)) return;
+
+    x0 &= ~(ILI9341_TILE_SIZE - 1);
+    y0 &= ~(ILI9341_TILE_SIZE - 1);
+    x1 |= ILI9341_TILE_SIZE - 1;
+    y1 |= ILI9341_TILE_SIZE - 1;
+
+    fill_tiles(render_attributes, x0, y0, x1, y1,
+               ILI9341_ATTRIBUTE(palette_entry(fg, DISPLAY_PALETTE_FG), palette_entry(bg, DISPLAY_PALETTE_BG)));
+    // Whole tiles change color, even the part outside the clip
+    mark_dirty_area(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+#else
+    (void)x0; (void)y0; (void)x1; (void)y1; (void)fg; (void)bg;
+#endif
+}
+
+#if !ILI9341_DISPLAY_LIST
+static void draw_char_1ppb(uint8_t* framebuffer, int x, int y, uint16_t glyph,
+                          uint16_t font_width, uint16_t font_height, const uint16_t* font_data,
+                          uint8_t fg_index, uint8_t bg_index) {
     // Validate inputs
-    if (!framebuffer || !font_data || font_width == 0 || font_height == 0 || 
-        character < 32 || character > 126) {
+    if (!framebuffer || !font_data || font_width == 0 || font_height == 0) {
         return;
     }
 
     // Calculate character index in font data
-    const int char_index = (character - 32) * font_height;
+    const int char_index = glyph * font_height;
+
+    // Trim the glyph to the clip rectangle once, rows below need no bounds test
+    const clip_rect_t* clip = clip_current();
+    int first_col = (x < clip->x0) ? (clip->x0 - x) : 0;
+    int last_col = (x + font_width - 1 > clip->x1) ? (clip->x1 - x) : (font_width - 1);
+    int first_row = (y < clip->y0) ? (clip->y0 - y) : 0;
+    int last_row = (y + font_height - 1 > clip->y1) ? (clip->y1 - y) : (font_height - 1);
+    if (first_col > last_col || first_row > last_row) {
+        return;
+    }
 
+    // Rows are MSB-first bitmaps: set bits take the foreground palette entry
+    for (int row = first_row; row <= last_row; ++row) {
+        draw_mono_row(framebuffer, x, y + row, font_data[char_index + row],
+                      first_col, last_col, fg_index, bg_index);
+    }
+}
 
-    // Iterate over each row of the character
-    for (int row = 0; row < font_height; ++row) {
-        uint16_t row_bitmap = font_data[char_index + row];
+#endif
 
-        // Iterate over each column of the character
-        for (int col = 0; col < font_width; ++col) {
-            // Extract bit from right to left (MSB at col 0)
-            uint8_t pixel_bit = (row_bitmap >> (15 - col)) & 0x01;
+#if ILI9341_BITS_PER_PIXEL > 1
+// RGB565 tone `step` of `steps` on the way from bg to fg, per channel
+static uint16_t blend_rgb565(uint16_t fg, uint16_t bg, uint8_t step, uint8_t steps) {
+    int32_t r = (bg >> 11) + (((int32_t)(fg >> 11) - (bg >> 11)) * step + steps / 2) / steps;
+    int32_t g = ((bg >> 5) & 0x3F) + (((int32_t)((fg >> 5) & 0x3F) - ((bg >> 5) & 0x3F)) * step + steps / 2) / steps;
+    int32_t b = (bg & 0x1F) + (((int32_t)(fg & 0x1F) - (bg & 0x1F)) * step + steps / 2) / steps;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
 
-            // Calculate absolute pixel coordinates
-            int pixel_x = x + col;
-            int pixel_y = y + row;
+// Map coverage levels of a glyph depth to palette entries for the current text colors.
+// The tables only change with the colors, not per glyph.
+static void prepare_blend(uint16_t fg, uint16_t bg, uint8_t bpp) {
+    uint32_t key = ((uint32_t)fg << 16) | bg;
+    if (key == blend_key && bpp == blend_bpp) return;
+    blend_key = key;
+    blend_bpp = bpp;
+
+    uint8_t tones[TEXT_BLEND_TONES + 2];
+    for (uint8_t step = 0; step < TEXT_BLEND_TONES + 2; ++step) {
+        tones[step] = palette_entry(blend_rgb565(fg, bg, step, TEXT_BLEND_TONES + 1),
+                                    (step * 2 > TEXT_BLEND_TONES + 1) ? DISPLAY_PALETTE_FG : DISPLAY_PALETTE_BG);
+    }
 
-            // Check bounds
-            if (pixel_x < 0 || pixel_x >= ILI9341_WIDTH || 
-                pixel_y < 0 || pixel_y >= ILI9341_HEIGHT) {
-                continue;
-            }
+    uint8_t max_level = (1 << bpp) - 1;
+    for (uint8_t level = 0; level <= max_level; ++level) {
+        blend_lut[level] = tones[(level * (TEXT_BLEND_TONES + 1) + max_level / 2) / max_level];
+    }
 
-            // Calculate framebuffer byte and bit offset
-            const int byte_offset = (pixel_y * ILI9341_WIDTH + pixel_x) / 8;
-            const int bit_shift = 7 - (pixel_x % 8);
+#if ILI9341_BITS_PER_PIXEL == 4 && !ILI9341_DISPLAY_LIST
+    if (bpp == 4) {
+        for (uint16_t pair = 0; pair < 256; ++pair) {
+            blend_byte_lut[pair] = (blend_lut[pair >> 4] << 4) | blend_lut[pair & 0x0F];
+        }
+    }
+#endif
+}
 
-            // Set or clear pixel based on bitmap
-            if (pixel_bit) {
-                framebuffer[byte_offset] |= (1 << bit_shift);
-            } else {
-                framebuffer[byte_offset] &= ~(1 << bit_shift);
+#if !ILI9341_DISPLAY_LIST
+// Anti-aliased glyph through the blend tables, background included like draw_char_1ppb
+static void draw_char_aa(uint8_t* framebuffer, int x, int y, uint16_t glyph_index, const font_def_t* font_info) {
+    if (!framebuffer) {
+        return;
+    }
+
+    uint8_t bpp = font_info->aa_bpp;
+    uint8_t per_byte = 8 / bpp;
+    uint8_t level_mask = (1 << bpp) - 1;
+    uint16_t stride = (font_info->width + per_byte - 1) / per_byte;
+    const uint8_t* glyph = &font_info->aa_data[glyph_index * stride * font_info->height];
+
+    // Trim against the clip rectangle once per glyph
+    const clip_rect_t* clip = clip_current();
+    int first_col = (x < clip->x0) ? (clip->x0 - x) : 0;
+    int last_col = (x + font_info->width - 1 > clip->x1) ? (clip->x1 - x) : (font_info->width - 1);
+    int first_row = (y < clip->y0) ? (clip->y0 - y) : 0;
+    int last_row = (y + font_info->height - 1 > clip->y1) ? (clip->y1 - y) : (font_info->height - 1);
+    if (first_col > last_col || first_row > last_row) {
+        return;
+    }
+    glyph += first_row * stride;
+
+#if ILI9341_BITS_PER_PIXEL == 4
+    // Glyph and framebuffer nibbles line up and no column is clipped: translate whole bytes
+    if (bpp == 4 && (x % 2) == 0 && (font_info->width % 2) == 0 &&
+        first_col == 0 && last_col == font_info->width - 1) {
+        for (int row = first_row; row <= last_row; ++row, glyph += stride) {
+            uint8_t* dst = &framebuffer[(y + row) * page_geometry.stride + (x / 2)];
+            for (uint16_t b = 0; b < stride; ++b) {
+                dst[b] = blend_byte_lut[glyph[b]];
             }
         }
+        return;
+    }
+#endif
+
+    for (int row = first_row; row <= last_row; ++row, glyph += stride) {
+        for (int col = first_col; col <= last_col; ++col) {
+            uint8_t shift = (per_byte - 1 - (col % per_byte)) * bpp;
+            uint8_t level = (glyph[col / per_byte] >> shift) & level_mask;
+            put_pixel(framebuffer, x + col, y + row, blend_lut[level]);
+        }
+    }
+}
+#endif
+#endif
+
+#if !ILI9341_DISPLAY_LIST
+// Draw one glyph with the best path the font and framebuffer depth allow
+static void draw_glyph(uint8_t* framebuffer, int x, int y, uint16_t glyph, const font_def_t* font_info) {
+#ifdef LAYOUT_GLYPH_PROFILE
+    // Time the 1bpp path on every glyph so the anti-aliased one has a baseline
+    uint32_t start = cycle_counter_now();
+    draw_char_1ppb(framebuffer, x, y, glyph, font_info->width, font_info->height, font_info->data,
+                   palette_index(color, DISPLAY_PALETTE_FG), palette_index(bg_color, DISPLAY_PALETTE_BG));
+    glyph_cycles_1bpp += cycle_counter_now() - start;
+    glyph_count++;
+#endif
+
+#if ILI9341_BITS_PER_PIXEL > 1
+    if (font_info->aa_data) {
+#ifdef LAYOUT_GLYPH_PROFILE
+        start = cycle_counter_now();
+#endif
+        prepare_blend(color, bg_color, font_info->aa_bpp);
+        draw_char_aa(framebuffer, x, y, glyph, font_info);
+#ifdef LAYOUT_GLYPH_PROFILE
+        glyph_cycles_aa += cycle_counter_now() - start;
+#endif
+        return;
     }
+#endif
+
+#ifndef LAYOUT_GLYPH_PROFILE
+    draw_char_1ppb(framebuffer, x, y, glyph, font_info->width, font_info->height, font_info->data,
+                   palette_index(color, DISPLAY_PALETTE_FG), palette_index(bg_color, DISPLAY_PALETTE_BG));
+#endif
+}
+#endif
+
+// Glyphs of a text in a font, decoded again only when the text or font changed.
+// Control characters are dropped, codepoints the font lacks show as '?'.
+static const text_glyphs_t* decode_text(const char* str, const font_def_t* font_info) {
+    if (decoded.font == font_info && strcmp(decoded.source, str) == 0) {
+        return &decoded;
+    }
+
+    decoded.font = font_info;
+    strncpy(decoded.source, str, sizeof(decoded.source) - 1);
+    decoded.source[sizeof(decoded.source) - 1] = '\0';
+    decoded.space = font_glyph(font_info, ' ');
+    decoded.count = 0;
+
+    uint16_t missing = font_glyph(font_info, '?');
+    const char* p = decoded.source;
+    while (*p && decoded.count < sizeof(decoded.glyphs) / sizeof(decoded.glyphs[0])) {
+        uint32_t codepoint = utf8_next(&p);
+        if (codepoint < 32) continue;
+
+        uint16_t glyph = font_glyph(font_info, codepoint);
+        if (glyph == FONT_NO_GLYPH) glyph = missing;
+        if (glyph != FONT_NO_GLYPH) decoded.glyphs[decoded.count++] = glyph;
+    }
+    return &decoded;
+}
+
+// Width of a run of `count` glyphs
+static uint16_t run_width(uint16_t count, const font_def_t* font_info, int spacing) {
+    return count ? (count * font_info->width) + ((count - 1) * spacing) : 0;
 }
 
 // Check if string fits without wrapping
-static bool is_fit_screen_size(const char* str, const font_def_t* font_info, int spacing) {
-    if (!str || !font_info || !font_info->data) return false;
-    size_t length = strlen(str);
-    uint16_t total_width = (length * font_info->width) + ((length - 1) * spacing);
-    return total_width <= ILI9341_WIDTH;
+static bool is_fit_screen_size(const text_glyphs_t* glyphs, const font_def_t* font_info, int spacing) {
+    if (!glyphs || !font_info || !font_info->data) return false;
+    return run_width(glyphs->count, font_info, spacing) <= page_geometry.width;
 }
 
 // Compute line breaks and store in static arrays
-static uint16_t compute_line_breaks(const char* str, const font_def_t* font_info, int spacing,
+static uint16_t compute_line_breaks(const text_glyphs_t* glyphs, const font_def_t* font_info, int spacing,
                                    uint16_t* max_line_width) {
-    const char* start = str;
+    uint8_t start = 0;
     uint16_t line_count = 0;
     *max_line_width = 0;
 
-    while (*start && line_count < MAX_LINES) {
+    while (start < glyphs->count && line_count < MAX_LINES) {
         uint16_t line_width = 0;
-        const char* end = start;
-        const char* last_space = NULL;
+        uint8_t end = start;
+        int16_t last_space = -1;
         size_t chars_in_line = 0;
 
-        while (*end && line_width < ILI9341_WIDTH) {
-            if (*end == ' ') last_space = end;
+        while (end < glyphs->count && line_width < page_geometry.width) {
+            if (glyphs->glyphs[end] == glyphs->space) last_space = end;
             line_width += font_info->width + (chars_in_line > 0 ? spacing : 0);
-            if (line_width > ILI9341_WIDTH && last_space) {
+            if (line_width > page_geometry.width && last_space >= 0) {
                 end = last_space;
                 break;
             }
@@ -132,15 +682,15 @@ static uint16_t compute_line_breaks(const char* str, const font_def_t* font_info
             ++chars_in_line;
         }
 
-        size_t segment_length = (end - start);
-        if (line_width > ILI9341_WIDTH && last_space) {
+        uint8_t segment_length = end - start;
+        if (line_width > page_geometry.width && last_space >= 0) {
             segment_length = last_space - start;
-        } else if (!*end) {
-            segment_length = strlen(start);
+        } else if (end >= glyphs->count) {
+            segment_length = glyphs->count - start;
         }
 
         // Recalculate line_width based on the actual segment length
-        line_width = (segment_length * font_info->width) + ((segment_length > 1) ? ((segment_length - 1) * spacing) : 0);
+        line_width = run_width(segment_length, font_info, spacing);
 
         line_starts[line_count] = start;
         line_lengths[line_count] = segment_length;
@@ -148,7 +698,7 @@ static uint16_t compute_line_breaks(const char* str, const font_def_t* font_info
         if (line_width > *max_line_width) *max_line_width = line_width;
         ++line_count;
 
-        start = (*end && last_space) ? end + 1 : end;
+        start = (end < glyphs->count && last_space >= 0) ? end + 1 : end;
     }
     return line_count;
 }
@@ -156,45 +706,73 @@ static uint16_t compute_line_breaks(const char* str, const font_def_t* font_info
 // Calculate the aligned base position for the text block
 static void calculate_block_position(uint16_t line_count, uint16_t max_line_width,
                                     uint16_t font_height, uint16_t* base_x, uint16_t* base_y) {
-    *base_x = (uint16_t)x_pos;
-    *base_y = (uint16_t)y_pos;
+    uint16_t origin_x = area.s.x + x_pos;
+    uint16_t origin_y = area.s.y + y_pos;
+    *base_x = origin_x;
+    *base_y = origin_y;
     uint16_t total_height = line_count * font_height;
 
     if (align.alignment != ALIGN_NONE) {
         if (align.alignment == ALIGN_CENTER) {
-            *base_x = (uint16_t)(x_pos + ((width - max_line_width) >> 1));
+            *base_x = (uint16_t)(origin_x + ((width - max_line_width) >> 1));
         } else if (align.alignment == ALIGN_RIGHT) {
-            *base_x = (uint16_t)(x_pos + (width - max_line_width));
+            *base_x = (uint16_t)(origin_x + (width - max_line_width));
         }
 
-        *base_y = (uint16_t)(y_pos + ((height - total_height) >> 1)); // Auto apply vertical alignment
+        *base_y = (uint16_t)(origin_y + ((height - total_height) >> 1)); // Auto apply vertical alignment
 
         // Clamp to valid range
-        if (*base_x >= ILI9341_WIDTH) *base_x = ILI9341_WIDTH - 1;
-        if (*base_y >= ILI9341_HEIGHT) *base_y = ILI9341_HEIGHT - 1;
+        if (*base_x >= page_geometry.width) *base_x = page_geometry.width - 1;
+        if (*base_y >= page_geometry.height) *base_y = page_geometry.height - 1;
     }
 }
 
 // Draw a single line with alignment
-static void draw_one_line(const char* segment, uint16_t draw_x, uint16_t draw_y,
+static void draw_one_line(const uint16_t* glyphs, uint8_t count, int16_t draw_x, int16_t draw_y,
                          const font_def_t* font_info, int spacing,
                          const display_info_t* display_info) {
-    uint16_t font_width = font_info->width;
-    uint16_t draw_pos_x = draw_x;
+    int16_t draw_end_x = draw_x;
 
     uint8_t* render_buff = get_render_screen(display_info);
 
-    if (render_buff) {
-        for (const char* p = segment; *p; ++p) {
-            if (*p < 32 || *p > 126) continue; // Skip non-printable
-
-            draw_char_1ppb(render_buff, draw_pos_x, draw_y, *p, font_info->width, font_info->height, font_info->data);
-            draw_pos_x += font_width + spacing;
+    // Lines entirely above or below the clip are not rasterized at all
+    const clip_rect_t* clip = clip_current();
+    if (draw_y > clip->y1 || draw_y + font_info->height - 1 < clip->y0) {
+        return;
+    }
 
-            if (draw_pos_x >= ILI9341_WIDTH) {
+    if (render_buff) {
+#if ILI9341_DISPLAY_LIST
+        // The whole line is one command, glyphs are expanded row by row at scanout
+        const uint8_t* levels = NULL;
+        if (font_info->aa_data) {
+            prepare_blend(color, bg_color, font_info->aa_bpp);
+            levels = blend_lut;
+        }
+        draw_end_x = draw_x + display_list_text(render_buff, draw_x, draw_y, glyphs, count, font_info, spacing,
+                                                palette_index(color, DISPLAY_PALETTE_FG),
+                                                palette_index(bg_color, DISPLAY_PALETTE_BG), levels);
+#else
+        uint16_t font_width = font_info->width;
+        int16_t draw_pos_x = draw_x;
+
+        for (uint8_t i = 0; i < count; ++i) {
+            // Past the right clip edge the rest of the line is invisible
+            if (draw_pos_x > clip->x1) {
                 break;
             }
+
+            // Glyphs left of the clip are skipped whole, partial ones are trimmed once
+            if (draw_pos_x + font_width - 1 >= clip->x0) {
+                draw_glyph(render_buff, draw_pos_x, draw_y, glyphs[i], font_info);
+            }
+            draw_end_x = draw_pos_x + font_width;
+            draw_pos_x += font_width + spacing;
         }
+#endif
+
+        color_tiles(draw_x, draw_y, draw_end_x - 1, draw_y + font_info->height - 1, color, bg_color);
+        mark_dirty_box(draw_x, draw_y, draw_end_x - 1, draw_y + font_info->height - 1);
     }
 }
 
@@ -218,20 +796,23 @@ static void draw_string(const char* str, int spacing) {
         return;
     }
 
-    // Check if string fits without wrapping
-    if (is_fit_screen_size(str, font_info, spacing)) {
-        size_t text_length = strlen(str);
-        uint16_t text_width = (text_length * font_info->width) + ((text_length - 1) * spacing);
+    const text_glyphs_t* glyphs = decode_text(str, font_info);
+    if (glyphs->count == 0) {
+        return;
+    }
+
+    // Check if string fits without wrapping; scrolled areas keep their text on one line however long
+    if (area_scrolls || is_fit_screen_size(glyphs, font_info, spacing)) {
+        uint16_t text_width = run_width(glyphs->count, font_info, spacing);
         uint16_t base_x, base_y;
         calculate_block_position(1, text_width, font_info->height, &base_x, &base_y);
-        draw_one_line(str, base_x, base_y, font_info, spacing, display_info);
-        set_ready_screen(display_info);
+        draw_one_line(glyphs->glyphs, glyphs->count, base_x + area_shift, base_y, font_info, spacing, display_info);
         return;
     }
 
     // Precompute line breaks
     uint16_t max_line_width;
-    uint16_t line_count = compute_line_breaks(str, font_info, spacing, &max_line_width);
+    uint16_t line_count = compute_line_breaks(glyphs, font_info, spacing, &max_line_width);
 
     // Calculate block position
     uint16_t base_x, base_y;
@@ -239,14 +820,8 @@ static void draw_string(const char* str, int spacing) {
 
     // Draw each line
     for (uint16_t line = 0; line < line_count; ++line) {
-        // Extract line segment
-        char segment[MAX_CHAR_PER_LINE];
-        strncpy(segment, line_starts[line], line_lengths[line]);
-        segment[line_lengths[line]] = '\0';
-
         // Calculate line-specific width
-        uint16_t line_pixel_width = (line_lengths[line] * font_info->width) +
-                                   ((line_lengths[line] - 1) * spacing);
+        uint16_t line_pixel_width = run_width(line_lengths[line], font_info, spacing);
 
         // Apply horizontal alignment for this line
         uint16_t draw_x = base_x;
@@ -255,16 +830,16 @@ static void draw_string(const char* str, int spacing) {
         } else if (align.alignment == ALIGN_RIGHT) {
             draw_x = (uint16_t)(base_x + (max_line_width - line_pixel_width));
         }
-        draw_x = (draw_x >= ILI9341_WIDTH) ? (ILI9341_WIDTH - 1) : ((draw_x < 0) ? 0 : draw_x);
+        draw_x = (draw_x >= page_geometry.width) ? (page_geometry.width - 1) : ((draw_x < 0) ? 0 : draw_x);
         uint16_t draw_y = base_y + (line * font_info->height);
 
         // Draw the current line
-        draw_one_line(segment, draw_x, draw_y, font_info, spacing, display_info);
+        draw_one_line(&glyphs->glyphs[line_starts[line]], line_lengths[line], draw_x + area_shift, draw_y,
+                      font_info, spacing, display_info);
 
         // Stop if off screen
-        if (draw_y >= ILI9341_HEIGHT) break;
+        if (draw_y >= page_geometry.height) break;
     }
-    set_ready_screen(display_info);
 }
 
 static void draw_layout(void) {
@@ -277,6 +852,773 @@ static void draw_layout(void) {
     draw_string((const char*)text, 1);
 }
 
+static void draw_rect_element(void) {
+    if (!render_buff) return;
+
+    int16_t x = area.s.x + area_shift + x_pos;
+    int16_t y = area.s.y + y_pos;
+
+    uint8_t index = palette_index(color, DISPLAY_PALETTE_FG);
+
+    if (fill) {
+        fill_round_rect(render_buff, x, y, width, height, radius, index);
+    } else {
+        draw_round_rect(render_buff, x, y, width, height, radius, index);
+    }
+    color_tiles(x, y, x + width - 1, y + height - 1, color, bg_color);
+    mark_dirty_box(x, y, x + width - 1, y + height - 1);
+}
+
+static void draw_line_element(void) {
+    if (!render_buff) return;
+
+    int16_t x0 = area.s.x + area_shift + line_x1;
+    int16_t y0 = area.s.y + line_y1;
+    int16_t x1 = area.s.x + area_shift + line_x2;
+    int16_t y1 = area.s.y + line_y2;
+
+    draw_line(render_buff, x0, y0, x1, y1, palette_index(color, DISPLAY_PALETTE_FG));
+    color_tiles((x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1,
+                (x0 > x1) ? x0 : x1, (y0 > y1) ? y0 : y1, color, bg_color);
+    mark_dirty_box((x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1,
+                   (x0 > x1) ? x0 : x1, (y0 > y1) ? y0 : y1);
+}
+
+// Image at its own size inside the element box; align centers it like a text block
+static void image_origin(const image_info_entry_t* image, int16_t* x, int16_t* y) {
+    *x = area.s.x + x_pos;
+    *y = area.s.y + y_pos;
+    if (align.alignment != ALIGN_NONE) {
+        if (align.alignment == ALIGN_CENTER) {
+            *x += ((int16_t)width - image->width) / 2;
+        } else if (align.alignment == ALIGN_RIGHT) {
+            *x += (int16_t)width - image->width;
+        }
+        *y += ((int16_t)height - image->height) / 2;
+    }
+}
+
+static void draw_image_element(void) {
+    if (!render_buff) return;
+
+    const uint8_t* data = NULL;
+    const image_info_entry_t* image = get_image_info(image_index, &data);
+    if (!image) return;
+
+    int16_t x, y;
+    image_origin(image, &x, &y);
+    x += area_shift;
+
+    uint8_t fg_index = palette_index(color, DISPLAY_PALETTE_FG);
+    uint8_t bg_index = palette_index(bg_color, DISPLAY_PALETTE_BG);
+    if (image->encoding == IMAGE_ENCODING_RLE) {
+        draw_rle_image(render_buff, x, y, image->width, image->height, data, fg_index, bg_index);
+    } else {
+        draw_bitmap(render_buff, x, y, image->width, image->height, data, fg_index, bg_index);
+    }
+    color_tiles(x, y, x + image->width - 1, y + image->height - 1, color, bg_color);
+    mark_dirty_box(x, y, x + image->width - 1, y + image->height - 1);
+}
+
+// Widget pixels get the element colors, like any other element
+static void invalidate_widget(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    color_tiles(x0, y0, x1, y1, color, bg_color);
+    mark_dirty_box(x0, y0, x1, y1);
+}
+
+static void draw_widget_element(void) {
+    const widget_class_t* widget = get_widget_class(widget_type);
+    if (!widget || !render_buff) return;
+
+    uint16_t widget_width, widget_height;
+    widget->measure(widget->props, width, height, &widget_width, &widget_height);
+    if (widget_width > width) widget_width = width;
+    if (widget_height > height) widget_height = height;
+
+    widget_context_t ctx = {
+        .framebuffer = render_buff,
+        .x = area.s.x + area_shift + x_pos,
+        .y = area.s.y + y_pos + ((height - widget_height) >> 1),
+        .width = widget_width,
+        .height = widget_height,
+        .fg_index = palette_index(color, DISPLAY_PALETTE_FG),
+        .bg_index = palette_index(bg_color, DISPLAY_PALETTE_BG),
+        .invalidate = invalidate_widget,
+    };
+    if (align.alignment == ALIGN_CENTER) {
+        ctx.x += (width - widget_width) >> 1;
+    } else if (align.alignment == ALIGN_RIGHT) {
+        ctx.x += width - widget_width;
+    }
+
+    widget_instance_t* instance = widget_slot;
+    uint32_t layout_id = get_prepared_layout_id();
+
+    // Same widget at the same place on the same layout, and the area was not repainted under it.
+    // A display list is rebuilt every frame, scrolled areas only draw strips and animation frames
+    // only their damage, so nothing is retained there.
+    bool partial = area_scrolls || (render_pass == RENDER_PASS_DAMAGE && !element_in_place);
+    bool retained = !ILI9341_DISPLAY_LIST && !partial && instance && instance->valid && !area_cleared &&
+                    instance->type == widget_type && instance->layout_id == layout_id &&
+                    instance->x == ctx.x && instance->y == ctx.y &&
+                    instance->width == ctx.width && instance->height == ctx.height &&
+                    instance->fg_index == ctx.fg_index && instance->bg_index == ctx.bg_index;
+
+    if (!retained || !widget->update || !widget->update(&ctx, widget->props, instance->props)) {
+        widget->render(&ctx, widget->props);
+    }
+
+    if (instance && widget->props_size <= WIDGET_PROPS_MAX) {
+        // A widget cut by the damage is not all there, the next full frame draws it whole
+        instance->valid = (render_pass != RENDER_PASS_DAMAGE || element_in_place);
+        instance->type = widget_type;
+        instance->layout_id = layout_id;
+        instance->x = ctx.x;
+        instance->y = ctx.y;
+        instance->width = ctx.width;
+        instance->height = ctx.height;
+        instance->fg_index = ctx.fg_index;
+        instance->bg_index = ctx.bg_index;
+        memcpy(instance->props, widget->props, widget->props_size);
+    }
+}
+
+// Draw the element whose properties have been collected so far
+static void draw_element(void) {
+    switch (element) {
+    case ELEMENT_TEXT:
+        draw_layout();
+        break;
+    case ELEMENT_RECT:
+        draw_rect_element();
+        break;
+    case ELEMENT_LINE:
+        draw_line_element();
+        break;
+    case ELEMENT_WIDGET:
+        draw_widget_element();
+        break;
+    case ELEMENT_IMAGE:
+        draw_image_element();
+        break;
+    case ELEMENT_NONE:
+        break;
+    }
+}
+
+// Box of a text block, laid out the way draw_string() does it
+static bool text_bounds(int16_t* x0, int16_t* y0, int16_t* x1, int16_t* y1) {
+    if (text[0] == '\0' || font >= FONT_TYPE_COUNT || !font_table[font].data) {
+        return false;
+    }
+
+    const font_def_t* font_info = &font_table[font];
+    const text_glyphs_t* glyphs = decode_text(text, font_info);
+    if (glyphs->count == 0) {
+        return false;
+    }
+
+    uint16_t block_width, line_count = 1;
+    if (area_scrolls || is_fit_screen_size(glyphs, font_info, 1)) {
+        block_width = run_width(glyphs->count, font_info, 1);
+    } else {
+        line_count = compute_line_breaks(glyphs, font_info, 1, &block_width);
+    }
+
+    uint16_t base_x, base_y;
+    calculate_block_position(line_count, block_width, font_info->height, &base_x, &base_y);
+    *x0 = base_x;
+    *y0 = base_y;
+    *x1 = base_x + block_width - 1;
+    *y1 = base_y + line_count * font_info->height - 1;
+    return true;
+}
+
+// Screen box the current element draws into, clipped to its area; false if nothing shows
+static bool element_bounds(clip_rect_t* box) {
+    int16_t x0 = area.s.x + x_pos;
+    int16_t y0 = area.s.y + y_pos;
+    int16_t x1 = x0 + width - 1;
+    int16_t y1 = y0 + height - 1;
+
+    if (element == ELEMENT_LINE) {
+        x0 = area.s.x + ((line_x1 < line_x2) ? line_x1 : line_x2);
+        y0 = area.s.y + ((line_y1 < line_y2) ? line_y1 : line_y2);
+        x1 = area.s.x + ((line_x1 > line_x2) ? line_x1 : line_x2);
+        y1 = area.s.y + ((line_y1 > line_y2) ? line_y1 : line_y2);
+    } else if (element == ELEMENT_IMAGE) {
+        const uint8_t* data = NULL;
+        const image_info_entry_t* image = get_image_info(image_index, &data);
+        if (!image) return false;
+
+        image_origin(image, &x0, &y0);
+        x1 = x0 + image->width - 1;
+        y1 = y0 + image->height - 1;
+    } else if (element == ELEMENT_TEXT) {
+        if (!text_bounds(&x0, &y0, &x1, &y1)) return false;
+    }
+
+    if (!clip_box(&x0, &y0, &x1, &y1)) {
+        return false;
+    }
+    box->x0 = x0;
+    box->y0 = y0;
+    box->x1 = x1;
+    box->y1 = y1;
+    return true;
+}
+
+// Redraw an inclusive box on the next damage pass
+static void add_damage(const clip_rect_t* box) {
+    int16_t x0 = box->x0, y0 = box->y0;
+    int16_t x1 = box->x1, y1 = box->y1;
+
+#if ILI9341_USE_ATTRIBUTE_MAP
+    // Colors belong to whole tiles, so does the damage
+    x0 &= ~(ILI9341_TILE_SIZE - 1);
+    y0 &= ~(ILI9341_TILE_SIZE - 1);
+    x1 |= ILI9341_TILE_SIZE - 1;
+    y1 |= ILI9341_TILE_SIZE - 1;
+#endif
+    dirty_region_add(&damage, x0, y0, x1, y1);
+}
+
+static bool damage_overlaps(const clip_rect_t* box) {
+    for (uint8_t i = 0; i < damage.count; ++i) {
+        const dirty_rect_t* rect = &damage.rects[i];
+        if (box->x0 <= rect->x1 && box->x1 >= rect->x0 && box->y0 <= rect->y1 && box->y1 >= rect->y0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Put the tween values of the element in place. Tweened colors draw with the
+// entries their tweens own.
+static void apply_tweens(uint16_t* values) {
+    clear_tween_colors();
+    for (uint8_t i = 0; i < element_tween_count; ++i) {
+        bool running;
+        values[i] = tween_value(&element_tweens[i].tween, frame_time, &running);
+        *(uint16_t*)field_mappings[element_tweens[i].property].value = values[i];
+        timeline_running |= running;
+
+#if ILI9341_BITS_PER_PIXEL > 1 || ILI9341_USE_ATTRIBUTE_MAP
+        if (element_tweens[i].tween.color) {
+            uint8_t entry = tween_palette_entry(&current_node->palette_entries[i], values[i]);
+            if (field_mappings[element_tweens[i].property].value == &color) {
+                tween_fg_entry = entry;
+            } else {
+                tween_bg_entry = entry;
+            }
+            palette_frozen = true;
+        }
+#endif
+    }
+#if ILI9341_BITS_PER_PIXEL > 1
+    if (palette_frozen) {
+        blend_key = UINT32_MAX;
+    }
+#endif
+}
+
+// Compare the element with the way its node was last drawn. Measuring turns what
+// changed into damage, or lets a widget whose own properties changed update in place.
+static void measure_element(scene_node_t* node, const uint16_t* values) {
+    clip_rect_t bounds = {0};
+    bool visible = element_bounds(&bounds);
+    bool moved = !node->drawn || node->visible != visible ||
+                 memcmp(node->values, values, sizeof(node->values)) != 0 ||
+                 (visible && memcmp(&node->bounds, &bounds, sizeof(bounds)) != 0);
+
+    // Scrolled areas only redraw what their scroll exposes
+    if (render_pass == RENDER_PASS_MEASURE && !area_scrolls) {
+        if (!moved && visible && node->change == SCENE_CHANGE_WIDGET_PROPS && !ILI9341_DISPLAY_LIST) {
+            node->in_place = true;
+        } else if (moved || node->change != SCENE_CHANGE_NONE) {
+            if (node->drawn && node->visible) {
+                add_damage(&node->bounds);
+            }
+            if (visible) {
+                add_damage(&bounds);
+            }
+        }
+    }
+
+    node->drawn = true;
+    node->visible = visible;
+    node->bounds = bounds;
+    memcpy(node->values, values, sizeof(node->values));
+}
+
+// A widget the damage cuts into cannot update in place, it is redrawn whole
+static bool settle_in_place(void) {
+    bool any = false;
+    bool grown = true;
+
+    while (grown) {
+        grown = false;
+        any = false;
+        for (uint8_t i = 0; i < scene_count(); ++i) {
+            scene_node_t* node = scene_node(i);
+            if (!node->in_place) continue;
+
+            if (damage_overlaps(&node->bounds)) {
+                node->in_place = false;
+                add_damage(&node->bounds);
+                grown = true;
+            } else {
+                any = true;
+            }
+        }
+    }
+    return any;
+}
+
+static void capture_element(scene_node_t* node) {
+    memset(node, 0, sizeof(*node));
+    node->props.element = element;
+    node->props.widget_type = widget_type;
+    node->props.x = x_pos;
+    node->props.y = y_pos;
+    node->props.width = width;
+    node->props.height = height;
+    node->props.color = color;
+    node->props.bg_color = bg_color;
+    node->props.radius = radius;
+    node->props.line_x1 = line_x1;
+    node->props.line_y1 = line_y1;
+    node->props.line_x2 = line_x2;
+    node->props.line_y2 = line_y2;
+    node->props.font = font;
+    node->props.fill = fill;
+    node->props.align = align.alignment;
+    node->props.image = image_index;
+    strncpy(node->props.text, text, sizeof(node->props.text) - 1);
+
+    const widget_class_t* widget = (element == ELEMENT_WIDGET) ? get_widget_class(widget_type) : NULL;
+    if (widget && widget->props_size <= WIDGET_PROPS_MAX) {
+        memcpy(node->widget_props, widget->props, widget->props_size);
+    }
+    memcpy(node->tweens, element_tweens, element_tween_count * sizeof(scene_tween_t));
+    node->tween_count = element_tween_count;
+    node->widget_slot = widget_slot ? (uint8_t)(widget_slot - widget_instances) : UINT8_MAX;
+}
+
+// Area properties, read back by latch_area()
+static void capture_area(scene_node_t* node) {
+    memset(node, 0, sizeof(*node));
+    node->props.element = ELEMENT_NONE;
+    node->props.x = x_pos;
+    node->props.y = y_pos;
+    node->props.width = width;
+    node->props.height = height;
+    node->props.color = color;
+    node->props.bg_color = bg_color;
+    node->props.scroll_offset = scroll_offset;
+    node->props.has_background = has_background;
+    node->props.has_color = has_color;
+    node->props.has_scroll = has_scroll;
+    node->content = area_content;
+    node->widget_slot = UINT8_MAX;
+}
+
+static void restore_node(const scene_node_t* node) {
+    element = ELEMENT_NONE;
+    widget_type = node->props.widget_type;
+    x_pos = node->props.x;
+    y_pos = node->props.y;
+    width = node->props.width;
+    height = node->props.height;
+    color = node->props.color;
+    bg_color = node->props.bg_color;
+    radius = node->props.radius;
+    line_x1 = node->props.line_x1;
+    line_y1 = node->props.line_y1;
+    line_x2 = node->props.line_x2;
+    line_y2 = node->props.line_y2;
+    scroll_offset = node->props.scroll_offset;
+    font = node->props.font;
+    fill = node->props.fill;
+    align.alignment = node->props.align;
+    image_index = node->props.image;
+    has_background = node->props.has_background;
+    has_color = node->props.has_color;
+    has_scroll = node->props.has_scroll;
+    memcpy(text, node->props.text, sizeof(text));
+
+    const widget_class_t* widget = (node->props.element == ELEMENT_WIDGET) ? get_widget_class(widget_type) : NULL;
+    if (widget && widget->props_size <= WIDGET_PROPS_MAX) {
+        memcpy(widget->props, node->widget_props, widget->props_size);
+    }
+    memcpy(element_tweens, node->tweens, sizeof(element_tweens));
+    element_tween_count = node->tween_count;
+    widget_slot = (node->widget_slot < MAX_WIDGETS) ? &widget_instances[node->widget_slot] : NULL;
+}
+
+// Parsing turns the element into a scene node; walks draw it once per strip of the area, clipped to it
+static void flush_element(void) {
+    if (element == ELEMENT_NONE) return;
+
+    if (render_pass == RENDER_PASS_PARSE) {
+        scene_node_t node;
+        capture_element(&node);
+        scene_add(&node);
+        element = ELEMENT_NONE;
+        return;
+    }
+
+    uint16_t values[TWEENS_PER_ELEMENT] = {0};
+    apply_tweens(values);
+    if (render_pass != RENDER_PASS_DAMAGE) {
+        measure_element(current_node, values);
+    }
+    if (render_pass == RENDER_PASS_MEASURE) {
+        element = ELEMENT_NONE;
+        return;
+    }
+
+    // Widget updating in place: drawn in its area, regardless of the damage
+    if (render_pass == RENDER_PASS_DAMAGE && current_node->in_place) {
+        element_in_place = true;
+        draw_element();
+        element_in_place = false;
+        element = ELEMENT_NONE;
+        return;
+    }
+
+    // On a damage pass elements away from the damage are not drawn at all.
+    // Display lists still record everything, scanout windows may reach past the damage.
+    const clip_rect_t* bounds = &current_node->bounds;
+    bool cull = !ILI9341_DISPLAY_LIST && render_pass == RENDER_PASS_DAMAGE && !area_scrolls;
+    if (cull && !current_node->visible) {
+        element = ELEMENT_NONE;
+        return;
+    }
+
+    for (uint8_t i = 0; i < area_strip_count; ++i) {
+        const clip_rect_t* strip = &area_strips[i].rect;
+        if (cull && (bounds->x1 < strip->x0 || bounds->x0 > strip->x1 ||
+                     bounds->y1 < strip->y0 || bounds->y0 > strip->y1)) {
+            continue;
+        }
+
+        clip_push(strip->x0, strip->y0, strip->x1, strip->y1);
+        area_shift = area_strips[i].shift;
+        draw_element();
+        clip_pop();
+    }
+    area_shift = 0;
+    element = ELEMENT_NONE;
+}
+
+// Area properties default to the root geometry
+static void begin_area(void) {
+    flush_element();
+
+    x_pos = layout_defaults.x_pos;
+    y_pos = layout_defaults.y_pos;
+    width = layout_defaults.width;
+    height = layout_defaults.height;
+    color = layout_defaults.color;
+    bg_color = layout_defaults.bg_color;
+
+    scroll_offset = 0;
+
+    has_background = false;
+    has_color = false;
+    has_scroll = false;
+    area_cleared = false;
+    area_latched = false;
+    area_scrolls = false;
+}
+
+// Content column `column` of a scrolled area lives in panel column start + column % size,
+// and the panel shows the region from `scroll` on. Only content columns that were not
+// visible at the previous offset become strips; the rest is still in panel memory.
+// Measuring turns those strips into damage. The damage pass then takes every visible
+// column, cut down to the damage, and programs the scroll.
+// At rotations the panel cannot scroll, the area is drawn whole and shifted instead,
+// each time its offset moves.
+static void scroll_area_strips(void) {
+    uint16_t size = area.e.x - area.s.x;
+    if (scroll_claimed || size == 0) {
+        return; // Drawn unscrolled, the panel has one scroll region
+    }
+    scroll_claimed = true;
+    area_scrolls = true;
+
+    uint32_t first = scroll_offset;
+    uint32_t last = (uint32_t)scroll_offset + size;
+    uint16_t prev = scroll_state.offset;
+    bool kept = (render_pass != RENDER_PASS_DAMAGE &&
+        scroll_state.valid && scroll_state.layout_id == get_prepared_layout_id() &&
+        scroll_state.content == area_content &&
+        memcmp(&scroll_state.area, &area, sizeof(area)) == 0 &&
+        scroll_state.color == area_color && scroll_state.bg_color == area_bg_color);
+
+    area_strip_count = 0;
+    if (!column_scroll) {
+        if (!(kept && scroll_offset == prev) && scroll_offset <= INT16_MAX) {
+            area_strips[0].rect.x0 = area.s.x;
+            area_strips[0].rect.y0 = area.s.y;
+            area_strips[0].rect.x1 = area.e.x - 1;
+            area_strips[0].rect.y1 = area.e.y - 1;
+            area_strips[0].shift = -(int16_t)scroll_offset;
+            area_strip_count = 1;
+        }
+    } else if (kept) {
+        if (scroll_offset == prev) {
+            last = first;
+        } else if (scroll_offset > prev && scroll_offset < prev + size) {
+            first = (uint32_t)prev + size;
+        } else if (scroll_offset < prev && scroll_offset + size > prev) {
+            last = prev;
+        }
+    }
+
+    while (column_scroll && first < last && area_strip_count < 2) {
+        uint16_t column = first % size;
+        uint16_t count = ((last - first) < (uint32_t)(size - column)) ? (last - first) : (size - column);
+
+        // Content never reaches past int16 coordinates, strips beyond stay background
+        if (first - column <= INT16_MAX) {
+            area_strips[area_strip_count].rect.x0 = area.s.x + column;
+            area_strips[area_strip_count].rect.y0 = area.s.y;
+            area_strips[area_strip_count].rect.x1 = area.s.x + column + count - 1;
+            area_strips[area_strip_count].rect.y1 = area.e.y - 1;
+            area_strips[area_strip_count].shift = -(int16_t)(first - column);
+            area_strip_count++;
+        }
+        first += count;
+    }
+
+    if (render_pass == RENDER_PASS_MEASURE) {
+        for (uint8_t i = 0; i < area_strip_count; ++i) {
+            add_damage(&area_strips[i].rect);
+        }
+        return;
+    }
+
+    scroll_state.valid = true;
+    scroll_state.layout_id = get_prepared_layout_id();
+    scroll_state.content = area_content;
+    scroll_state.area = area;
+    scroll_state.color = area_color;
+    scroll_state.bg_color = area_bg_color;
+    scroll_state.offset = scroll_offset;
+
+    const display_driver_t* driver = get_display_driver();
+    if (driver && driver->set_scroll) {
+        driver->set_scroll(area.s.x, column_scroll ? size : 0, scroll_offset % size);
+    }
+}
+
+// Animation frames redraw the strips only where they meet the damage
+static void clip_strips_to_damage(void) {
+    area_strip_t strips[2];
+    uint8_t strip_count = (area_strip_count < 2) ? area_strip_count : 2;
+
+    memcpy(strips, area_strips, strip_count * sizeof(area_strip_t));
+    area_strip_count = 0;
+
+    for (uint8_t i = 0; i < strip_count; ++i) {
+        for (uint8_t j = 0; j < damage.count && area_strip_count < AREA_STRIPS_MAX; ++j) {
+            const dirty_rect_t* rect = &damage.rects[j];
+            area_strip_t* strip = &area_strips[area_strip_count];
+
+            strip->rect.x0 = (strips[i].rect.x0 > rect->x0) ? strips[i].rect.x0 : rect->x0;
+            strip->rect.y0 = (strips[i].rect.y0 > rect->y0) ? strips[i].rect.y0 : rect->y0;
+            strip->rect.x1 = (strips[i].rect.x1 < rect->x1) ? strips[i].rect.x1 : rect->x1;
+            strip->rect.y1 = (strips[i].rect.y1 < rect->y1) ? strips[i].rect.y1 : rect->y1;
+            strip->shift = strips[i].shift;
+            if (strip->rect.x0 <= strip->rect.x1 && strip->rect.y0 <= strip->rect.y1) {
+                area_strip_count++;
+            }
+        }
+    }
+}
+
+// Fix the area rectangle once its own properties are parsed and clear its background
+static void latch_area(void) {
+    uint16_t right = x_pos + width;
+    uint16_t bottom = y_pos + height;
+
+    area.s.x = (x_pos < page_geometry.width) ? x_pos : page_geometry.width;
+    area.s.y = (y_pos < page_geometry.height) ? y_pos : page_geometry.height;
+    area.e.x = (right < page_geometry.width) ? right : page_geometry.width;
+    area.e.y = (bottom < page_geometry.height) ? bottom : page_geometry.height;
+    area_latched = true;
+    area_color = color;
+    area_bg_color = bg_color;
+
+    // Nothing drawn for this area may leave it
+    clip_push(area.s.x, area.s.y, area.e.x - 1, area.e.y - 1);
+
+    if (render_pass == RENDER_PASS_PARSE) {
+        // The area content is what follows its own properties, up to <END>
+        const char* content = (const char*)line.data_ptr;
+        const char* end = strstr(content, "<END>");
+        area_content = djb2_hash(content, end ? (size_t)(end - content) : strlen(content));
+
+        scene_node_t node;
+        capture_area(&node);
+        scene_add(&node);
+        return;
+    }
+
+    area_strips[0].rect.x0 = area.s.x;
+    area_strips[0].rect.y0 = area.s.y;
+    area_strips[0].rect.x1 = area.e.x - 1;
+    area_strips[0].rect.y1 = area.e.y - 1;
+    area_strips[0].shift = 0;
+    area_strip_count = 1;
+    if (has_scroll) {
+        scroll_area_strips();
+    }
+    if (render_pass == RENDER_PASS_DAMAGE && !ILI9341_DISPLAY_LIST) {
+        clip_strips_to_damage();
+    }
+
+    if (render_pass == RENDER_PASS_MEASURE || area.e.x <= area.s.x || area.e.y <= area.s.y) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < area_strip_count; ++i) {
+        const clip_rect_t* strip = &area_strips[i].rect;
+
+#if !ILI9341_DISPLAY_LIST
+        if (render_buff) {
+            validate_rows(strip->y0, strip->y1);
+        }
+#endif
+        if (has_background && render_buff) {
+            fill_rect(render_buff, strip->x0, strip->y0, strip->x1 - strip->x0 + 1, strip->y1 - strip->y0 + 1,
+                      palette_index(area_bg_color, DISPLAY_PALETTE_BG));
+            mark_dirty_area(strip->x0, strip->y0, strip->x1 - strip->x0 + 1, strip->y1 - strip->y0 + 1);
+            area_cleared = true;
+        }
+
+        // Area colors go to the attribute map so elements inherit them per tile
+        if (has_background || has_color) {
+            color_tiles(strip->x0, strip->y0, strip->x1, strip->y1, area_color, area_bg_color);
+        }
+    }
+}
+
+// Element properties are relative to the area and default to filling it
+static void begin_element(element_type_t type) {
+    flush_element();
+    if (!area_latched) {
+        latch_area();
+    }
+
+    element = type;
+    element_tween_count = 0;
+    x_pos = 0;
+    y_pos = 0;
+    width = area.e.x - area.s.x;
+    height = area.e.y - area.s.y;
+    text[0] = '\0';
+    color = area_color;
+    bg_color = area_bg_color;
+    fill = 0;
+    radius = 0;
+    line_x1 = line_y1 = line_x2 = line_y2 = 0;
+    image_index = UINT8_MAX;
+    align.alignment = ALIGN_NONE;
+}
+
+// Widget properties start zeroed, besides the common element ones
+static void begin_widget(uint8_t type) {
+    begin_element(ELEMENT_WIDGET);
+    widget_type = type;
+    widget_slot = (widget_count < MAX_WIDGETS) ? &widget_instances[widget_count++] : NULL;
+
+    const widget_class_t* widget = get_widget_class(widget_type);
+    if (widget) {
+        memset(widget->props, 0, widget->props_size);
+    }
+}
+
+// Parse a "key:value" line against a field table; false if no key of the table starts the line
+static bool parse_mapped_field(const char* line_text, const uint8_t* content,
+                               const field_mapping_t* mappings, size_t count) {
+    // The key has to start the line ("x:" must not match "max:")
+    for (size_t i = 0; i < count; i++) {
+        char pattern[32];
+        size_t pattern_len = snprintf(pattern, sizeof(pattern), "%s:", mappings[i].key);
+        if (strncmp(line_text, pattern, pattern_len) != 0) {
+            continue;
+        }
+
+        if (parse_field(content, mappings[i].key, mappings[i].value,
+                        mappings[i].size, mappings[i].type) != 1) {
+            printf("Failed to parse field: %s\n", mappings[i].key);
+            // Continue on failure to attempt other fields
+        } else if (mappings[i].value == &bg_color && element == ELEMENT_NONE) {
+            has_background = true;
+        } else if (mappings[i].value == &color && element == ELEMENT_NONE) {
+            has_color = true;
+        } else if (mappings[i].value == &scroll_offset && element == ELEMENT_NONE) {
+            has_scroll = true;
+        }
+        return true; // Assume one field per line, move to next line
+    }
+    return false;
+}
+
+// `band:<first> <last>` columns of the layout
+static void parse_band(const char* spec) {
+    unsigned int first, last;
+
+    if (sscanf(spec, "%u %u", &first, &last) != 2 || last < first || first > UINT16_MAX) {
+        printf("Band ignored: %s\n", spec);
+        return;
+    }
+    layout_band.start = first;
+    layout_band.size = (last - first + 1 > UINT16_MAX) ? UINT16_MAX : (last - first + 1);
+}
+
+// `tween:<key> <from> <to> <ms> <easing> <repeat>` on one of the numeric element properties
+static void add_tween(const char* spec) {
+    char key[12];
+    long from, to;
+    unsigned int duration, easing, repeat;
+
+    if (element == ELEMENT_NONE || element_tween_count >= TWEENS_PER_ELEMENT ||
+        sscanf(spec, "%11s %li %li %u %u %u", key, &from, &to, &duration, &easing, &repeat) != 6) {
+        printf("Tween ignored: %s\n", spec);
+        return;
+    }
+
+    for (size_t i = 0; i < num_mappings; i++) {
+        if (strcmp(key, field_mappings[i].key) != 0 || field_mappings[i].type != FIELD_TYPE_UINT16 ||
+            field_mappings[i].value == &scroll_offset) {
+            continue;
+        }
+
+        scene_tween_t* tween = &element_tweens[element_tween_count++];
+        tween->property = (uint8_t)i;
+        tween->tween.from = (uint16_t)from;
+        tween->tween.to = (uint16_t)to;
+        tween->tween.duration_ms = (uint16_t)duration;
+        tween->tween.easing = (easing < EASING_COUNT) ? easing : EASING_LINEAR;
+        tween->tween.repeat = (uint8_t)repeat;
+        tween->tween.color = (field_mappings[i].value == &color || field_mappings[i].value == &bg_color);
+        return;
+    }
+    printf("Tween ignored: %s\n", spec);
+}
+
+static void end_area(void) {
+    flush_element();
+    if (!area_latched) {
+        latch_area();
+    }
+    clip_pop();
+}
+
 bool is_script_ready(void) {
     return script_ready;
 }
@@ -293,19 +1635,21 @@ static void init_rendering_layout(void) {
 }
 
 static void init_layout_info(default_info_t* info) {
+    layout_defaults = *info;
+
     x_pos = info->x_pos;
     y_pos = info->y_pos;
 
     width = info->width;
     height = info->height;
 
-    color = swap_byte(info->color);
-    bg_color = swap_byte(info->bg_color);
+    color = info->color;
+    bg_color = info->bg_color;
 }
 
 static void execute_rendering(void) {
     char temp[50] = {0}; // Buffer for line data, capped at 49 chars + null
-    printf("%d\n", num_mappings);
+    uint8_t type;
 
      while (get_next_script_line(&script, &line)) {
         if (line.length >= sizeof(temp)) {
@@ -319,40 +1663,285 @@ static void execute_rendering(void) {
             continue;
         }
         else if (strstr(temp, "<START>")) {
-            // Layout start
+            // Area start
+            begin_area();
             continue;
         } else if (strstr(temp, "<END>")) {
-            // Layout end
-            draw_layout();
+            // Area end
+            end_area();
+            continue;
+        } else if (strstr(temp, "<TEXT>")) {
+            begin_element(ELEMENT_TEXT);
+            continue;
+        } else if (strstr(temp, "<RECT>")) {
+            begin_element(ELEMENT_RECT);
+            continue;
+        } else if (strstr(temp, "<LINE>")) {
+            begin_element(ELEMENT_LINE);
+            continue;
+        } else if (strstr(temp, "<IMAGE>")) {
+            begin_element(ELEMENT_IMAGE);
+            continue;
+        } else if (sscanf(temp, "<WIDGET:%hhu>", &type) == 1) {
+            begin_widget(type);
+            continue;
+        } else if (strncmp(temp, "tween:", 6) == 0) {
+            add_tween(temp + 6);
+            continue;
+        } else if (strncmp(temp, "band:", 5) == 0) {
+            parse_band(temp + 5);
+            continue;
+        } else if (strncmp(temp, "idle:", 5) == 0) {
+            layout_band.idle = (strcmp(temp + 5, "0") != 0);
             continue;
         } else {
-            // Parse fields
-            for (size_t i = 0; i < num_mappings; i++) {
-                char pattern[32];
-                snprintf(pattern, sizeof(pattern), "%s:", field_mappings[i].key);
-                if (strstr(temp, pattern)) {
-                    if (parse_field(line.data_ptr, field_mappings[i].key, field_mappings[i].value,
-                                field_mappings[i].size, field_mappings[i].type) != 1) {
-                        printf("Failed to parse field: %s\n", field_mappings[i].key);
-                        // Continue on failure to attempt other fields
-                    }
-                    break; // Assume one field per line, move to next line
-                }
+            // Widget properties first, then the ones every element has
+            const widget_class_t* widget = (element == ELEMENT_WIDGET) ? get_widget_class(widget_type) : NULL;
+            if (widget && parse_mapped_field(temp, line.data_ptr, widget->fields, widget->field_count)) {
+                continue;
             }
+            parse_mapped_field(temp, line.data_ptr, field_mappings, num_mappings);
         }
     }
 }
 
-bool render_layout(void) {
-    bool res = false;
+// Timeline position of the frame about to be drawn
+static void update_timeline(void) {
+    uint32_t layout_id = get_prepared_layout_id();
+    TickType_t now = xTaskGetTickCount();
 
-    default_info_t* default_info = get_root_info();
+    if (!timeline_started || timeline_layout_id != layout_id) {
+        timeline_started = true;
+        timeline_layout_id = layout_id;
+        timeline_origin = now;
+    }
 
-    init_layout_info(default_info);
+    frame_time = (uint32_t)(now - timeline_origin) * portTICK_PERIOD_MS;
+    timeline_running = false;
+}
 
+// Parse the script into the scene; true if the layout has to be drawn whole
+static bool parse_scene(void) {
+    init_layout_info(get_root_info());
     init_rendering_layout();
 
+    render_pass = RENDER_PASS_PARSE;
+    element = ELEMENT_NONE;
+    widget_count = 0;
+    memset(&layout_band, 0, sizeof(layout_band));
+    clip_reset();
+    scene_begin(get_prepared_layout_id());
     execute_rendering();
+    return scene_end();
+}
+
+// A changed area damages its old and new rectangle, its elements are inside them.
+// Scrolled areas find their changes themselves.
+static void measure_area(scene_node_t* node) {
+    clip_rect_t bounds = {area.s.x, area.s.y, area.e.x - 1, area.e.y - 1};
+    bool visible = (area.e.x > area.s.x && area.e.y > area.s.y);
+
+    if (render_pass == RENDER_PASS_MEASURE && !area_scrolls && node->change != SCENE_CHANGE_NONE) {
+        if (node->drawn && node->visible) {
+            add_damage(&node->bounds);
+        }
+        if (visible) {
+            add_damage(&bounds);
+        }
+    }
+
+    node->drawn = true;
+    node->visible = visible;
+    node->bounds = bounds;
+}
 
-    return res;
-}
\ No newline at end of file
+// Walk the scene in drawing order: areas latch their rectangle, elements draw inside it
+static void walk_scene(render_pass_t pass) {
+    bool in_area = false;
+
+    render_pass = pass;
+    scroll_claimed = false;
+    clip_reset();
+
+    for (uint8_t i = 0; i < scene_count(); ++i) {
+        current_node = scene_node(i);
+        restore_node(current_node);
+
+        if (current_node->props.element == ELEMENT_NONE) {
+            if (in_area) {
+                clip_pop();
+            }
+            area_cleared = false;
+            area_scrolls = false;
+            area_content = current_node->content;
+            clear_tween_colors();
+            latch_area();
+            if (pass != RENDER_PASS_DAMAGE) {
+                measure_area(current_node);
+            }
+            in_area = true;
+        } else {
+            element = current_node->props.element;
+            flush_element();
+        }
+    }
+
+    if (in_area) {
+        clip_pop();
+    }
+    clear_tween_colors();
+    current_node = NULL;
+}
+
+// The nodes are on screen as they are now
+static void clear_changes(void) {
+    for (uint8_t i = 0; i < scene_count(); ++i) {
+        scene_node(i)->change = SCENE_CHANGE_NONE;
+        scene_node(i)->in_place = false;
+    }
+}
+
+// Hand the page over to scanout
+static void finish_frame(void) {
+    const display_driver_t* driver = get_display_driver();
+    clear_changes();
+
+    // No area scrolls on this frame: hand the panel back its plain layout
+    if (!scroll_claimed) {
+        if (driver && driver->set_scroll) {
+            driver->set_scroll(0, 0, 0);
+        }
+        scroll_state.valid = false;
+    }
+
+    // A layout without a band is full screen, the panel leaves partial mode for it
+    if (driver && driver->set_band) {
+        driver->set_band(layout_band.start, layout_band.size, layout_band.idle);
+    }
+    sent_band = layout_band;
+#if ILI9341_DISPLAY_LIST
+    if (display_list_dropped(render_buff)) {
+        printf("display list full, %u commands dropped\n", display_list_dropped(render_buff));
+    }
+#endif
+
+    set_ready_screen();
+}
+
+// Redraw what changed since the last frame; false when nothing did
+static bool render_changes(void) {
+    dirty_region_reset(&damage);
+    walk_scene(RENDER_PASS_MEASURE);
+    bool in_place = settle_in_place();
+
+    // A placeholder may move the band alone, the frame still carries it to the panel
+    bool band_moved = (layout_band.start != sent_band.start || layout_band.size != sent_band.size ||
+                       layout_band.idle != sent_band.idle);
+
+    if (dirty_region_is_empty(&damage) && !in_place && !band_moved) {
+        clear_changes();
+        return false;
+    }
+
+#if ILI9341_DISPLAY_LIST
+    display_list_begin(render_buff);
+#endif
+    // Damage shows the root background until the elements under it are drawn again
+    render_pass = RENDER_PASS_DAMAGE;
+    clip_reset();
+    for (uint8_t i = 0; i < damage.count; ++i) {
+        const dirty_rect_t* rect = &damage.rects[i];
+        uint16_t w = rect->x1 - rect->x0 + 1;
+        uint16_t h = rect->y1 - rect->y0 + 1;
+#if !ILI9341_DISPLAY_LIST
+        validate_rows(rect->y0, rect->y1);
+        fill_rect(render_buff, rect->x0, rect->y0, w, h, DISPLAY_PALETTE_BG);
+#if ILI9341_USE_ATTRIBUTE_MAP
+        fill_tiles(render_attributes, rect->x0, rect->y0, rect->x1, rect->y1,
+                   ILI9341_ATTRIBUTE(DISPLAY_PALETTE_FG, DISPLAY_PALETTE_BG));
+#endif
+#endif
+        mark_dirty_area(rect->x0, rect->y0, w, h);
+    }
+    walk_scene(RENDER_PASS_DAMAGE);
+
+    finish_frame();
+    return true;
+}
+
+// Draw every node over an invalidated page: whatever the previous layout or
+// rotation left in it is never read again.
+static bool render_whole(void) {
+    // Another layout may have been drawn since a widget was, none of them is on screen as kept
+    for (uint8_t i = 0; i < MAX_WIDGETS; ++i) {
+        widget_instances[i].valid = false;
+    }
+
+#if ILI9341_DISPLAY_LIST
+    display_list_begin(render_buff);
+#endif
+    // Rows are cleared as areas first draw into them, the rest goes out as background
+    geometry_changed = false;
+    scroll_state.valid = false;
+    render_pass = RENDER_PASS_FULL;
+    invalidate_page();
+    // Nothing on the page refers to an entry any more
+    reset_palette();
+#ifdef LAYOUT_GLYPH_PROFILE
+    // The display driver started the counter at init and times frames with it
+    glyph_count = glyph_cycles_1bpp = glyph_cycles_aa = 0;
+#endif
+    walk_scene(RENDER_PASS_FULL);
+#ifdef LAYOUT_GLYPH_PROFILE
+    if (glyph_count) {
+        printf("glyph cycles: 1bpp %lu, anti-aliased %lu (%lu glyphs)\n",
+               (unsigned long)(glyph_cycles_1bpp / glyph_count), (unsigned long)(glyph_cycles_aa / glyph_count),
+               (unsigned long)glyph_count);
+    }
+#endif
+
+    finish_frame();
+    return true;
+}
+
+bool render_layout(void) {
+    render_buff = acquire_render_buffer();
+    if (!render_buff) {
+        // No page to draw into yet: the layout task renders the update on its next tick
+        render_pending = true;
+        return false;
+    }
+    render_pending = false;
+
+    update_timeline();
+
+    // Same layout, same nodes, same page size: only what the update changed is drawn
+    if (!parse_scene() && !geometry_changed) {
+        return render_changes();
+    }
+    return render_whole();
+}
+
+void set_layout_rotation(display_rotation_t rotation) {
+    if (rotation < DISPLAY_ROTATION_COUNT) {
+        layout_rotation = rotation;
+    }
+}
+
+bool is_render_pending(void) {
+    return render_pending;
+}
+
+bool is_layout_animating(void) {
+    return timeline_running;
+}
+
+bool render_animation_frame(void) {
+    render_buff = acquire_render_buffer();
+    if (!render_buff) {
+        return false; // Tried again on the next tick
+    }
+
+    update_timeline();
+    return geometry_changed ? render_whole() : render_changes();
+}
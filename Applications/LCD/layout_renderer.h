@@ -33,5 +33,13 @@ typedef struct {
 bool get_script_ready(void);
 void set_script_ready(void);
 bool render_layout(void);
+// render_layout() found no free page; the update is still to be drawn
+bool is_render_pending(void);
+// Animation frames, see layout_timeline.h. render_animation_frame() redraws what the
+// running tweens moved and returns false when there was nothing to send.
+bool is_layout_animating(void);
+bool render_animation_frame(void);
+// Rotation of the frames from the next one on; that frame is drawn whole at the new size
+void set_layout_rotation(display_rotation_t rotation);
 
 #endif /* _RENDERING_H_ */
\ No newline at end of file
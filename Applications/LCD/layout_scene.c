@@ -0,0 +1,81 @@
+#include "main.h"
+#include "layout_scene.h"
+
+static scene_node_t nodes[SCENE_MAX_NODES];
+static uint8_t node_count;
+static uint32_t scene_layout_id;
+
+// Parse in progress
+static uint8_t parsed_count;
+static uint16_t dropped_count;
+static bool structure_changed;
+
+void scene_begin(uint32_t layout_id) {
+    structure_changed = (node_count == 0 || layout_id != scene_layout_id);
+    scene_layout_id = layout_id;
+    parsed_count = 0;
+    dropped_count = 0;
+}
+
+void scene_add(const scene_node_t* parsed) {
+    if (parsed_count >= SCENE_MAX_NODES) {
+        dropped_count++;
+        return;
+    }
+
+    scene_node_t* node = &nodes[parsed_count++];
+    if (parsed_count > node_count ||
+        node->props.element != parsed->props.element ||
+        node->props.widget_type != parsed->props.widget_type) {
+        structure_changed = true;
+    }
+
+    // What changed since the node was drawn, a change not drawn yet is kept
+    uint8_t change = SCENE_CHANGE_NONE;
+    if (memcmp(&node->props, &parsed->props, sizeof(node->props)) != 0 ||
+        node->tween_count != parsed->tween_count ||
+        memcmp(node->tweens, parsed->tweens, sizeof(node->tweens)) != 0 ||
+        node->widget_slot != parsed->widget_slot || node->content != parsed->content) {
+        change = SCENE_CHANGE_ALL;
+    } else if (memcmp(node->widget_props, parsed->widget_props, sizeof(node->widget_props)) != 0) {
+        change = SCENE_CHANGE_WIDGET_PROPS;
+    }
+    if (change > node->change) {
+        node->change = change;
+    }
+
+    memcpy(&node->props, &parsed->props, sizeof(node->props));
+    memcpy(node->widget_props, parsed->widget_props, sizeof(node->widget_props));
+    memcpy(node->tweens, parsed->tweens, sizeof(node->tweens));
+    node->tween_count = parsed->tween_count;
+    node->widget_slot = parsed->widget_slot;
+    node->content = parsed->content;
+}
+
+bool scene_end(void) {
+    if (dropped_count) {
+        printf("scene full, %u nodes dropped\n", dropped_count);
+    }
+
+    if (parsed_count != node_count) {
+        structure_changed = true;
+    }
+    node_count = parsed_count;
+
+    if (structure_changed) {
+        for (uint8_t i = 0; i < node_count; ++i) {
+            nodes[i].change = SCENE_CHANGE_ALL;
+            nodes[i].drawn = false;
+            nodes[i].in_place = false;
+        }
+    }
+    return structure_changed;
+}
+
+uint8_t scene_count(void) {
+    return node_count;
+}
+
+scene_node_t* scene_node(uint8_t index) {
+    return (index < node_count) ? &nodes[index] : NULL;
+}
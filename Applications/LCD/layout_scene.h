@@ -0,0 +1,74 @@
+#ifndef _LAYOUT_SCENE_H_
+#define _LAYOUT_SCENE_H_
+
+#include "script_types.h"
+#include "layout_primitives.h"
+#include "layout_widgets.h"
+#include "layout_timeline.h"
+
+/*
+ * Retained scene of the shown layout. Parsing the script fills a static pool
+ * with one node per area and per element, in drawing order, each holding its
+ * resolved properties, so frames walk the nodes instead of the script text.
+ * A placeholder update parses into the same nodes again and marks the ones
+ * whose properties changed; a node also keeps where it was last drawn, so a
+ * frame only redraws the old and new bounds of what changed.
+ */
+
+#define SCENE_MAX_NODES         24
+
+typedef enum {
+    SCENE_CHANGE_NONE = 0,
+    SCENE_CHANGE_WIDGET_PROPS,  // only the widget's own properties, it may update in place
+    SCENE_CHANGE_ALL,
+} scene_change_t;
+
+// Properties as parsed; `element` is ELEMENT_NONE for an area
+typedef struct {
+    uint8_t element;
+    uint8_t widget_type;
+    uint16_t x, y, width, height;
+    uint16_t color, bg_color;
+    uint16_t radius;
+    uint16_t line_x1, line_y1, line_x2, line_y2;
+    uint16_t scroll_offset;
+    uint8_t font, fill, align, image;
+    bool has_background, has_color, has_scroll;
+    char text[50];
+} scene_props_t;
+
+typedef struct {
+    uint8_t property;           // index in the renderer's field table
+    tween_t tween;
+} scene_tween_t;
+
+typedef struct {
+    scene_props_t props;
+    uint8_t widget_props[WIDGET_PROPS_MAX];
+    scene_tween_t tweens[TWEENS_PER_ELEMENT];
+    uint8_t tween_count;
+    uint8_t widget_slot;        // widget instance, UINT8_MAX if none
+    uint32_t content;           // area: hash of its script, a scrolled area redraws when it changes
+
+    // State of the last frame that drew the node
+    uint8_t change;             // scene_change_t since then
+    bool drawn;
+    bool visible;
+    bool in_place;              // widget updating itself this frame, outside the damage
+    clip_rect_t bounds;         // screen box, clipped to the area
+    uint16_t values[TWEENS_PER_ELEMENT];
+    uint8_t palette_entries[TWEENS_PER_ELEMENT]; // owned by color tweens, UINT8_MAX if none
+} scene_node_t;
+
+// Parse the layout `layout_id` into the pool, node by node in drawing order
+void scene_begin(uint32_t layout_id);
+// Store a parsed node (everything but the last-drawn state) over the retained one
+void scene_add(const scene_node_t* parsed);
+// True when the nodes do not match the previous parse one for one, the
+// layout is then drawn whole; otherwise only changed nodes are marked
+bool scene_end(void);
+
+uint8_t scene_count(void);
+scene_node_t* scene_node(uint8_t index);
+
+#endif /* _LAYOUT_SCENE_H_ */
@@ -0,0 +1,57 @@
+#include "main.h"
+#include "layout_timeline.h"
+
+// Progress is fixed point, TWEEN_ONE being the end of a run
+#define TWEEN_ONE   1024
+
+// Quadratic curves, exact at both ends so a finished tween lands on `to`
+static uint32_t ease(uint8_t easing, uint32_t p) {
+    switch (easing) {
+    case EASING_IN:
+        return (p * p) / TWEEN_ONE;
+    case EASING_OUT:
+        return TWEEN_ONE - ((TWEEN_ONE - p) * (TWEEN_ONE - p)) / TWEEN_ONE;
+    case EASING_IN_OUT:
+        if (p < TWEEN_ONE / 2) {
+            return (2 * p * p) / TWEEN_ONE;
+        }
+        return TWEEN_ONE - (2 * (TWEEN_ONE - p) * (TWEEN_ONE - p)) / TWEEN_ONE;
+    default:
+        return p;
+    }
+}
+
+static int32_t lerp(int32_t from, int32_t to, uint32_t p) {
+    return from + ((to - from) * (int32_t)p) / TWEEN_ONE;
+}
+
+uint16_t tween_value(const tween_t* tween, uint32_t elapsed_ms, bool* running) {
+    uint32_t duration = tween->duration_ms ? tween->duration_ms : 1;
+    uint32_t p;
+
+    *running = true;
+    if (tween->repeat == TWEEN_ONCE) {
+        if (elapsed_ms >= duration) {
+            *running = false;
+            return tween->to;
+        }
+        p = (elapsed_ms * TWEEN_ONE) / duration;
+    } else if (tween->repeat == TWEEN_ALTERNATE) {
+        uint32_t phase = elapsed_ms % (2 * duration);
+        p = (((phase < duration) ? phase : (2 * duration - phase)) * TWEEN_ONE) / duration;
+    } else {
+        p = ((elapsed_ms % duration) * TWEEN_ONE) / duration;
+    }
+
+    p = ease(tween->easing, p);
+
+    if (!tween->color) {
+        return (uint16_t)lerp(tween->from, tween->to, p);
+    }
+
+    // RGB565 channels move independently, a plain lerp would carry between them
+    int32_t r = lerp(tween->from >> 11, tween->to >> 11, p);
+    int32_t g = lerp((tween->from >> 5) & 0x3F, (tween->to >> 5) & 0x3F, p);
+    int32_t b = lerp(tween->from & 0x1F, tween->to & 0x1F, p);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
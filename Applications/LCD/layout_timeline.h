@@ -0,0 +1,50 @@
+#ifndef _LAYOUT_TIMELINE_H_
+#define _LAYOUT_TIMELINE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Property tweens. An element line `tween:<key> <from> <to> <ms> <easing> <repeat>`
+ * (emitted by tml2obj.py from `tween: "x 0 200 1500 in_out loop"`) animates one
+ * of its numeric properties. Time runs from the moment the layout was switched
+ * to, so every tween of a layout shares one timeline. While any tween runs the
+ * layout task renders a frame every TIMELINE_FRAME_MS, and only the old and new
+ * bounds of the elements whose animated values changed are redrawn.
+ */
+
+#define TIMELINE_FRAME_RATE_HZ  30
+#define TIMELINE_FRAME_MS       (1000 / TIMELINE_FRAME_RATE_HZ)
+
+// Tweens of a single element
+#define TWEENS_PER_ELEMENT      2
+
+// Keep in sync with easing_map in Tools/tml2obj.py
+typedef enum {
+    EASING_LINEAR = 0,
+    EASING_IN,          // quadratic, slow start
+    EASING_OUT,         // quadratic, slow end
+    EASING_IN_OUT,
+    EASING_COUNT,
+} easing_t;
+
+// Keep in sync with repeat_map in Tools/tml2obj.py
+typedef enum {
+    TWEEN_ONCE = 0,     // stop at `to`
+    TWEEN_LOOP,         // jump back to `from`
+    TWEEN_ALTERNATE,    // run back and forth
+} tween_repeat_t;
+
+typedef struct {
+    uint16_t from, to;
+    uint16_t duration_ms;
+    uint8_t easing;
+    uint8_t repeat;
+    bool color;         // from/to are RGB565, blended per channel
+} tween_t;
+
+// Value of a tween `elapsed_ms` into the timeline. `running` is cleared once a
+// TWEEN_ONCE tween has reached its end value.
+uint16_t tween_value(const tween_t* tween, uint32_t elapsed_ms, bool* running);
+
+#endif /* _LAYOUT_TIMELINE_H_ */
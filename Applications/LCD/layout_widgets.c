@@ -0,0 +1,93 @@
+#include "main.h"
+#include "layout_widgets.h"
+#include "layout_primitives.h"
+
+/* ----------------- NaviBar --------------------- */
+// Row of `total` page indicators, the `current` one (0-based) filled
+
+#define NAVIBAR_DOT_SIZE    10
+#define NAVIBAR_DOT_GAP     8
+
+typedef struct {
+    uint8_t total;
+    uint8_t current;
+} navibar_props_t;
+
+static navibar_props_t navibar_props;
+
+static const field_mapping_t navibar_fields[] = {
+    {"total", &navibar_props.total, sizeof(uint8_t), FIELD_TYPE_UINT8},
+    {"current", &navibar_props.current, sizeof(uint8_t), FIELD_TYPE_UINT8},
+};
+
+// Indicators that do not fit the box are dropped
+static uint8_t navibar_visible(const navibar_props_t* props, uint16_t width) {
+    uint16_t fit = (width + NAVIBAR_DOT_GAP) / (NAVIBAR_DOT_SIZE + NAVIBAR_DOT_GAP);
+    return (props->total < fit) ? props->total : (uint8_t)fit;
+}
+
+static void navibar_measure(const void* props, uint16_t max_width, uint16_t max_height,
+                            uint16_t* width, uint16_t* height) {
+    uint8_t count = navibar_visible((const navibar_props_t*)props, max_width);
+
+    *width = count ? (count * (NAVIBAR_DOT_SIZE + NAVIBAR_DOT_GAP) - NAVIBAR_DOT_GAP) : 0;
+    *height = (max_height < NAVIBAR_DOT_SIZE) ? max_height : NAVIBAR_DOT_SIZE;
+}
+
+static void navibar_draw_cell(const widget_context_t* ctx, uint8_t index, bool selected) {
+    int16_t x = ctx->x + index * (NAVIBAR_DOT_SIZE + NAVIBAR_DOT_GAP);
+    uint16_t size = ctx->height;
+
+    if (selected) {
+        fill_round_rect(ctx->framebuffer, x, ctx->y, size, size, size / 2, ctx->fg_index);
+    } else {
+        fill_rect(ctx->framebuffer, x, ctx->y, size, size, ctx->bg_index);
+        draw_round_rect(ctx->framebuffer, x, ctx->y, size, size, size / 2, ctx->fg_index);
+    }
+    ctx->invalidate(x, ctx->y, x + size - 1, ctx->y + size - 1);
+}
+
+static void navibar_render(const widget_context_t* ctx, const void* props) {
+    const navibar_props_t* navibar = (const navibar_props_t*)props;
+    uint8_t count = navibar_visible(navibar, ctx->width);
+
+    for (uint8_t i = 0; i < count; ++i) {
+        navibar_draw_cell(ctx, i, i == navibar->current);
+    }
+}
+
+// Moving the selection only touches the cell left and the cell entered
+static bool navibar_update(const widget_context_t* ctx, const void* props, const void* prev_props) {
+    const navibar_props_t* navibar = (const navibar_props_t*)props;
+    const navibar_props_t* prev = (const navibar_props_t*)prev_props;
+    uint8_t count = navibar_visible(navibar, ctx->width);
+
+    if (navibar->total != prev->total) return false;
+    if (navibar->current == prev->current) return true;
+
+    if (prev->current < count) {
+        navibar_draw_cell(ctx, prev->current, false);
+    }
+    if (navibar->current < count) {
+        navibar_draw_cell(ctx, navibar->current, true);
+    }
+    return true;
+}
+
+/* ----------------- Registry --------------------- */
+
+static const widget_class_t widget_classes[WIDGET_TYPE_COUNT] = {
+    [WIDGET_NAVIBAR] = {
+        .fields = navibar_fields,
+        .field_count = sizeof(navibar_fields) / sizeof(field_mapping_t),
+        .props = &navibar_props,
+        .props_size = sizeof(navibar_props),
+        .measure = navibar_measure,
+        .render = navibar_render,
+        .update = navibar_update,
+    },
+};
+
+const widget_class_t* get_widget_class(uint8_t type) {
+    return (type < WIDGET_TYPE_COUNT) ? &widget_classes[type] : NULL;
+}
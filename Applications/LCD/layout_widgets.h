@@ -0,0 +1,48 @@
+#ifndef _LAYOUT_WIDGETS_H_
+#define _LAYOUT_WIDGETS_H_
+
+#include "script_types.h"
+
+/*
+ * Widgets are compiled-in element types that draw themselves. tml2obj.py emits
+ * `<WIDGET:n>` for a widget block, n being the index in widget_type_t, followed
+ * by its properties. The renderer parses properties listed in `fields` into the
+ * widget's own property block, measures it, then renders it, or only updates
+ * what changed when the same instance was drawn on the previous frame.
+ */
+
+// Keep in sync with widget_map in Tools/tml2obj.py
+typedef enum {
+    WIDGET_NAVIBAR = 0,
+    WIDGET_TYPE_COUNT,
+} widget_type_t;
+
+// Largest property block of any widget, retained per instance between frames
+#define WIDGET_PROPS_MAX    8
+
+typedef struct {
+    uint8_t* framebuffer;         // render page
+    int16_t x, y;                 // top-left of the measured widget box, screen coordinates
+    uint16_t width, height;       // measured widget box
+    uint8_t fg_index, bg_index;   // palette indices to draw with
+    void (*invalidate)(int16_t x0, int16_t y0, int16_t x1, int16_t y1); // report drawn pixels, inclusive
+} widget_context_t;
+
+typedef struct {
+    const field_mapping_t* fields;  // properties besides the common element ones
+    size_t field_count;
+    void* props;                    // property block the fields are parsed into
+    size_t props_size;
+
+    // Natural size for the current properties, within the element box
+    void (*measure)(const void* props, uint16_t max_width, uint16_t max_height,
+                    uint16_t* width, uint16_t* height);
+    // Draw the whole widget
+    void (*render)(const widget_context_t* ctx, const void* props);
+    // Redraw only what differs from prev_props; false when a full render is needed
+    bool (*update)(const widget_context_t* ctx, const void* props, const void* prev_props);
+} widget_class_t;
+
+const widget_class_t* get_widget_class(uint8_t type);
+
+#endif /* _LAYOUT_WIDGETS_H_ */
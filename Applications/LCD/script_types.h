@@ -28,6 +28,15 @@ typedef enum {
     ALIGN_LEFT,
 } alignment_type_t;
 
+typedef enum {
+    ELEMENT_NONE = 0,
+    ELEMENT_TEXT,
+    ELEMENT_RECT,
+    ELEMENT_LINE,
+    ELEMENT_WIDGET,
+    ELEMENT_IMAGE,
+} element_type_t;
+
 typedef enum {
     FIELD_TYPE_STRING,
     FIELD_TYPE_UINT8,
@@ -62,6 +71,20 @@ typedef struct {
     uint8_t placeholder_count;
 } layout_info_entry_t;
 
+/* ------ Image Table ------ */
+typedef enum {
+    IMAGE_ENCODING_RLE = 0, // row RLE, see draw_rle_image()
+    IMAGE_ENCODING_RAW,     // 1bpp rows, MSB first, padded to whole bytes
+} image_encoding_t;
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint8_t encoding;   // image_encoding_t, whichever was smaller
+    uint8_t reserved[3];
+    uint32_t offset;    // image data, from the end of the image table
+} image_info_entry_t;
+
 /* ------ Placeholder Info Table ------ */
 typedef struct {
     uint8_t length;
@@ -14,11 +14,12 @@
 UART_HandleTypeDef huart2;
 SPI_HandleTypeDef hspi2;
 DMA_HandleTypeDef hdma_spi2_tx;
+TIM_HandleTypeDef htim3;
+TIM_HandleTypeDef htim4;
 
 /* Private function prototypes -----------------------------------------------*/
 
 /* External functions --------------------------------------------------------*/
-extern void ili9341_dma_complete(void);
 /***********************************************************
  * Initialize HAL
  ***********************************************************/
@@ -29,6 +30,8 @@ void Init_Peripherals(void)
     DMA_Init();
     UART2_Init();
     SPI2_Init();
+    TIM3_Init();
+    TIM4_Init();
 }
 
 /***********************************************************
@@ -134,6 +137,54 @@ void HAL_MspInit(void)
 	// HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_0);
 }
 
+/**
+  * TIM3 times the delays of the LCD command queue: it counts at 10 kHz and is
+  * started for one delay at a time
+  */
+void TIM3_Init(void)
+{
+    uint32_t timer_clock = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+    {
+        timer_clock *= 2; // APB1 timers run at twice a divided bus clock
+    }
+
+    htim3.Instance = TIM3;
+    htim3.Init.Prescaler = (timer_clock / 10000U) - 1U;
+    htim3.Init.CounterMode = TIM_COUNTERMODE_UP;
+    htim3.Init.Period = 0xFFFF;
+    htim3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    htim3.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_Base_Init(&htim3) != HAL_OK)
+    {
+        // Error_Handler();
+    }
+}
+
+/**
+  * TIM4 is the LCD scanout watchdog: it counts at 10 kHz, the driver sets the
+  * timeout and restarts it with every transfer
+  */
+void TIM4_Init(void)
+{
+    uint32_t timer_clock = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+    {
+        timer_clock *= 2; // APB1 timers run at twice a divided bus clock
+    }
+
+    htim4.Instance = TIM4;
+    htim4.Init.Prescaler = (timer_clock / 10000U) - 1U;
+    htim4.Init.CounterMode = TIM_COUNTERMODE_UP;
+    htim4.Init.Period = 0xFFFF;
+    htim4.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    htim4.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_Base_Init(&htim4) != HAL_OK)
+    {
+        // Error_Handler();
+    }
+}
+
 /***********************************************************
  * Init the peripheral's low level hardware : GPIO, CLOCK,...
  ************************************************************/
@@ -176,6 +227,26 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef *uartHandle)
 	}
 }
 
+void HAL_TIM_Base_MspInit(TIM_HandleTypeDef* timHandle)
+{
+    if (timHandle->Instance == TIM3)
+    {
+        __HAL_RCC_TIM3_CLK_ENABLE();
+
+        /* Same priority as the SPI2 DMA: both step the LCD command queue */
+        HAL_NVIC_SetPriority(TIM3_IRQn, 10, 0);
+        HAL_NVIC_EnableIRQ(TIM3_IRQn);
+    }
+    else if (timHandle->Instance == TIM4)
+    {
+        __HAL_RCC_TIM4_CLK_ENABLE();
+
+        /* Same priority as the SPI2 DMA: never runs in the middle of its interrupt */
+        HAL_NVIC_SetPriority(TIM4_IRQn, 10, 0);
+        HAL_NVIC_EnableIRQ(TIM4_IRQn);
+    }
+}
+
 void HAL_SPI_MspInit(SPI_HandleTypeDef* spiHandle)
 {
   GPIO_InitTypeDef GPIO_InitStruct = {0};
@@ -253,12 +324,3 @@ void HAL_SPI_MspDeInit(SPI_HandleTypeDef* spiHandle)
         HAL_NVIC_DisableIRQ(SPI2_IRQn);
     }
 }
-
-void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
-{
-    if (hspi->Instance == SPI2) 
-    {
-        ili9341_dma_complete();
-        // HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_CS_PIN, GPIO_PIN_SET); // release CS
-    }
-}
\ No newline at end of file
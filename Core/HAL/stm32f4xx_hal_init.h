@@ -30,5 +30,7 @@ void GPIO_Init(void);
 void DMA_Init(void);
 void UART2_Init(void);
 void SPI2_Init(void);
+void TIM3_Init(void);
+void TIM4_Init(void);
 
 #endif /* __STM32F4xx_HAL_INIT_H */
\ No newline at end of file
@@ -0,0 +1,20 @@
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#include "stm32f4xx.h"
+
+// DWT cycle counter (CPU clock). The display driver starts it once at init and
+// times every frame with it; other users only read it, a reset would break
+// the frame times in flight.
+
+static inline void cycle_counter_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t cycle_counter_now(void) {
+    return DWT->CYCCNT;
+}
+
+#endif /* CYCLE_COUNTER_H */
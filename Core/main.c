@@ -112,10 +112,10 @@ void load_test_checkerboard(void *data) {
     if (data == NULL) return;
 
     uint16_t row;
-    ili9341_display_buffer_t* framebuffer = (ili9341_display_buffer_t*)data;
+    const display_driver_t* driver = ili9341_get_driver();
 
-    if (framebuffer->buffer_page[framebuffer->render_page].state == ILI9341_BUFFER_STATE_IDLE) {
-        uint8_t* source_buffer = (uint8_t*)&framebuffer->buffer_page[framebuffer->render_page].data[0];
+    uint8_t* source_buffer = driver->begin_frame();
+    if (source_buffer) {
         // Copy alternating row patterns to create checkerboard effect
         for (row = 0; row < ILI9341_HEIGHT; row++) {
             const uint8_t *row_pattern = ((row / ROWS_PER_BAND) % 2 == 0) ? 
@@ -123,7 +123,7 @@ void load_test_checkerboard(void *data) {
             memcpy(&source_buffer[row * ILI9341_BYTES_PER_ROW], row_pattern, ILI9341_BYTES_PER_ROW);
         }
 
-        framebuffer->buffer_page[framebuffer->render_page].state = ILI9341_BUFFER_STATE_READY_TO_DISPLAY;
+        driver->end_frame();
     }
 }
 
@@ -171,6 +171,9 @@ void Task_Init(void)
     BaseType_t ret = xTaskCreate(display_task, "display", 500, NULL, 5, NULL);
     configASSERT(ret == pdPASS);
 
+    ret = xTaskCreate(layout_task, "layout", 768, NULL, 4, NULL);
+    configASSERT(ret == pdPASS);
+
     // ret = xTaskCreate(test_display, "test", 300, NULL, 4, NULL);
 
     vTaskStartScheduler();
@@ -196,6 +199,10 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
   if (htim->Instance == TIM5) {
     HAL_IncTick();
+  } else if (htim->Instance == TIM3) {
+    ili9341_command_delay_elapsed();
+  } else if (htim->Instance == TIM4) {
+    ili9341_watchdog_expired();
   }
 }
 
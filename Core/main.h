@@ -11,6 +11,7 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdlib.h>
 #include "stm32f4xx_hal.h"
 #include "stm32f4xx_hal_init.h"
 #include "macro.h"
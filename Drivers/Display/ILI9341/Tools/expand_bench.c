@@ -0,0 +1,148 @@
+// Host check and benchmark of the 1 bpp expansion kernels (ili9341_expand.c).
+// Every kernel and expand_pixels are compared against a pixel by pixel
+// reference on random rows, then timed on a row of the full panel width.
+// Built and run by `make expand_bench`; the figures are the host's, the
+// driver still picks its kernel on the target at init.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ili9341_expand.h"
+
+#define ROW_BYTES       (320 / 8)
+#define CHECK_ROWS      2000
+#define BENCH_ROWS      200000
+#define GUARD_WORD      0xDEADBEEFu
+
+static uint16_t palette[16];
+
+// Color of pixel `x` as the panel should get it
+static uint16_t reference_pixel(const uint8_t* source, const uint8_t* attributes, uint16_t x) {
+    uint8_t attribute = attributes ? attributes[x / 8] : 0x10;
+    bool set = (source[x / 8] >> (7 - x % 8)) & 1;
+    return palette[set ? (attribute >> 4) : (attribute & 0x0F)];
+}
+
+// Pixels first..first + count - 1 of `out`, left pixel of each word in the low halfword
+static bool matches_reference(const uint32_t* out, const uint8_t* source, const uint8_t* attributes,
+                              uint16_t first, uint16_t count) {
+    for (uint16_t i = 0; i < count; ++i) {
+        uint32_t word = out[i / 2];
+        uint16_t pixel = (i % 2) ? (uint16_t)(word >> 16) : (uint16_t)word;
+        if (pixel != reference_pixel(source, attributes, first + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void random_row(uint8_t* source, uint8_t* attributes) {
+    for (uint8_t i = 0; i < ROW_BYTES; ++i) {
+        source[i] = (uint8_t)rand();
+        // Runs of equal tiles, as layouts have them
+        attributes[i] = (i && rand() % 4) ? attributes[i - 1] : (uint8_t)rand();
+    }
+}
+
+static bool check_kernels(void) {
+    uint8_t source[ROW_BYTES], attributes[ROW_BYTES];
+    uint32_t out[ROW_BYTES * 4 + 1];
+    bool ok = true;
+
+    for (uint8_t kernel = 0; kernel < EXPAND_KERNEL_COUNT; ++kernel) {
+        uint32_t failures = 0;
+        for (uint32_t row = 0; row < CHECK_ROWS; ++row) {
+            random_row(source, attributes);
+            uint16_t offset = rand() % ROW_BYTES;
+            uint16_t count = 1 + rand() % (ROW_BYTES - offset);
+            const uint8_t* tiles = (row % 2) ? &attributes[offset] : NULL;
+
+            out[count * 4] = GUARD_WORD;
+            expand_kernels[kernel](&source[offset], tiles, count, palette, out);
+            if (!matches_reference(out, &source[offset], tiles, 0, count * 8) || out[count * 4] != GUARD_WORD) {
+                failures++;
+            }
+        }
+        printf("%-14s %s (%lu of %u rows wrong)\n", expand_kernel_names[kernel], failures ? "FAIL" : "ok",
+               (unsigned long)failures, CHECK_ROWS);
+        ok &= (failures == 0);
+    }
+
+    uint32_t failures = 0;
+    for (uint32_t row = 0; row < CHECK_ROWS; ++row) {
+        random_row(source, attributes);
+        uint16_t x0 = (rand() % (ROW_BYTES * 4)) * 2;
+        uint16_t x1 = x0 + 1 + (rand() % ((ROW_BYTES * 8 - x0) / 2)) * 2;
+        const uint8_t* tiles = (row % 2) ? attributes : NULL;
+        uint16_t words = (x1 - x0 + 1) / 2;
+
+        out[words] = GUARD_WORD;
+        uint32_t* end = expand_pixels(source, tiles, x0, x1, palette, out);
+        if (!matches_reference(out, source, tiles, x0, x1 - x0 + 1) || end != &out[words] ||
+            out[words] != GUARD_WORD) {
+            failures++;
+        }
+    }
+    printf("%-14s %s (%lu of %u windows wrong)\n", "expand_pixels", failures ? "FAIL" : "ok",
+           (unsigned long)failures, CHECK_ROWS);
+    return ok && failures == 0;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Time stamp counter where there is one, 0 elsewhere
+#if defined(__x86_64__) || defined(__i386__)
+static uint64_t cycles_now(void) {
+    return __builtin_ia32_rdtsc();
+}
+#else
+static uint64_t cycles_now(void) {
+    return 0;
+}
+#endif
+
+// Same row as select_expand_kernel in the driver: colors changing every few tiles
+static void bench_kernels(void) {
+    uint8_t source[ROW_BYTES], attributes[ROW_BYTES];
+    static uint32_t out[ROW_BYTES * 4];
+
+    for (uint8_t i = 0; i < ROW_BYTES; ++i) {
+        source[i] = (uint8_t)(i * 0x9D) ^ 0x5A;
+        attributes[i] = (uint8_t)((1 + (i / 4) % 3) << 4);  // on background 0
+    }
+
+    for (uint8_t map = 0; map < 2; ++map) {
+        const uint8_t* tiles = map ? attributes : NULL;
+        printf("%s:\n", map ? "attribute map" : "plain");
+        for (uint8_t kernel = 0; kernel < EXPAND_KERNEL_COUNT; ++kernel) {
+            double start = now_ns();
+            uint64_t cycles = cycles_now();
+            for (uint32_t row = 0; row < BENCH_ROWS; ++row) {
+                expand_kernels[kernel](source, tiles, ROW_BYTES, palette, out);
+                // Keep the stores from being folded across rows
+                __asm__ volatile("" : : "r"(out) : "memory");
+            }
+            cycles = cycles_now() - cycles;
+            double elapsed = now_ns() - start;
+            printf("  %-14s %8.1f ns per row, %8.1f TSC cycles per row\n", expand_kernel_names[kernel],
+                   elapsed / BENCH_ROWS, (double)cycles / BENCH_ROWS);
+        }
+    }
+}
+
+int main(void) {
+    srand(1);
+    for (uint8_t i = 0; i < 16; ++i) {
+        palette[i] = (uint16_t)(0x1234 * (i + 1) ^ (i << 11));
+    }
+
+    if (!check_kernels()) {
+        return 1;
+    }
+    bench_kernels();
+    return 0;
+}
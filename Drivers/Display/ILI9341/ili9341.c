@@ -1,14 +1,63 @@
 #include "main.h"
+#include "cycle_counter.h"
+#include "ili9341_expand.h"
+#include "ili9341_spi.h"
 
 // SPI and GPIO configuration
-extern SPI_HandleTypeDef hspi2;
+extern TIM_HandleTypeDef htim3;
+extern TIM_HandleTypeDef htim4;
 extern EventGroupHandle_t display_event;
 
 // Timing constants (in milliseconds)
-#define ILI9341_DMA_TIMEOUT_COUNT   (100)
+#define ILI9341_WATCHDOG_MS         (200) // longer than any command delay
 #define ILI9341_RESET_DELAY_MS      (1)
+#define ILI9341_SW_RESET_DELAY_MS   (5)
 #define ILI9341_SLEEP_OUT_DELAY_MS  (120)
 #define ILI9341_BACKLIGHT_DELAY_MS  (13)
+#if ILI9341_MAX_FPS
+#define FRAME_INTERVAL_MS           ((1000 + ILI9341_MAX_FPS - 1) / ILI9341_MAX_FPS)
+#else
+#define FRAME_INTERVAL_MS           0
+#endif
+
+// Scanout expands two pixels at a time through a palette lookup table
+#define PAIR_BITS                   (2 * ILI9341_BITS_PER_PIXEL)
+#define PAIR_MASK                   ((1 << PAIR_BITS) - 1)
+#define PAIR_LUT_SIZE               (1 << PAIR_BITS)
+
+// Palette colors as they are stored in the line buffers
+#if ILI9341_SPI_16BIT
+#define PANEL_COLOR(rgb)            ((uint16_t)(rgb))
+#else
+#define PANEL_COLOR(rgb)            ((uint16_t)(((rgb) >> 8) | ((rgb) << 8)))
+#endif
+
+// Narrower windows are sent row by row even with continuous scanout: their rows
+// go out faster than the interrupt could expand the next one
+#define CONTINUOUS_MIN_WIDTH        64
+
+// Panel commands waiting for the SPI/DMA interrupt to send them, see queue_command()
+#define COMMAND_QUEUE_SIZE          32
+// Most commands a frame queues before the interrupt drains them: scroll (2) and
+// normal mode after the last frame, rotation, band (partial area, partial mode,
+// idle), the first window (3) and its continuous restart (3)
+#define FRAME_COMMANDS_MAX          13
+// The init sequence is queued in one go as well, sleep out included
+#define INIT_COMMANDS               20
+// TIM3 counts command delays at 10 kHz (TIM3_Init)
+#define DELAY_TICKS_PER_MS          10
+// TIM4, the scanout watchdog, counts at 10 kHz as well (TIM4_Init)
+#define WATCHDOG_TICKS_PER_MS       10
+
+// A run of solid rows goes out as one transfer of up to this many DMA items
+#define SOLID_MAX_ITEMS             0xFFFF
+
+// With byte frames the DMA repeats a single byte, so only colors of two equal bytes
+#if ILI9341_SPI_16BIT
+#define SOLID_COLOR_SENDABLE(color) (true)
+#else
+#define SOLID_COLOR_SENDABLE(color) (((color) >> 8) == ((color) & 0xFF))
+#endif
 
 #define CURRENT_RENDER_LINE_BUFFER  (line_buffer[active_buf_idx])
 #define CURRENT_DMA_LINE_BUFFER     (line_buffer[1 - active_buf_idx])
@@ -29,14 +78,39 @@ typedef enum
 // DMA control structure
 typedef struct
 {
-    uint8_t current_row; // Current row being processed
-    uint16_t wait_count; // DMA timeout counter
+    uint16_t current_row; // Current row being processed
+    uint8_t rect_index; // Index of the dirty rectangle being sent
+    dirty_rect_t window; // Panel window of the current transfer
     dma_write_type_t write_type; // Type of DMA operation
-    bool is_row_completed; // Flag for row completion
-    bool is_writing; // Flag for active DMA transfer
-    bool multiple_byte;
+    bool is_screen_done; // The interrupt sent the last row, the task ends the screen
+    bool is_writing; // A screen is being sent
+    bool timed_out; // The watchdog stopped the screen
+    bool row_expanded; // The next row waits in the render line buffer
+    bool solid; // The transfer repeats solid_color, memory increment is off
+#if ILI9341_CONTINUOUS_SCANOUT
+    uint16_t rows_sent; // Rows of a continuous window the DMA has sent
+    bool hold_cs; // CS stays low until the frame is over
+#endif
 } dma_control_t;
 
+// Panel command of the command queue; the payload is read when it is sent
+typedef struct
+{
+    uint8_t command;
+    uint8_t length; // Payload bytes
+    uint16_t delay_ms; // Wait after the command before the next one
+    const uint8_t* payload;
+} command_entry_t;
+
+// Where the interrupt is with the command at the queue tail
+typedef enum
+{
+    COMMAND_IDLE, // Queue empty, the bus is free for pixel rows
+    COMMAND_OPCODE, // Command byte going out, DC low
+    COMMAND_PAYLOAD, // Parameters going out, DC high
+    COMMAND_DELAY, // TIM3 running the delay of the command
+} command_phase_t;
+
 // Static variables
 static SemaphoreHandle_t dma_semaphore = NULL;
 static dma_control_t dma_control = {0};
@@ -45,14 +119,64 @@ static ili9341_operation_state_t current_state = ILI9341_STATE_READY;
 static ili9341_operation_state_t target_state = ILI9341_STATE_READY;
 static ili9341_display_buffer_t framebuffer;
 static uint16_t init_timeout_ms = 0;
-static uint8_t init_sequence_index = 0;
-static uint16_t line_buffer[2][ILI9341_WIDTH];
+static TimerHandle_t init_timer = NULL;
+static TimerHandle_t frame_timer = NULL; // wakes the task when a held back frame or a refresh is due
+static TickType_t last_frame_tick; // start of the last frame sent
+static display_stats_t frame_stats;
+static bool frame_held; // a page waits for the frame interval to pass
+static uint16_t line_buffer[2][ILI9341_WIDTH] __ALIGNED(4);
+static uint16_t solid_color; // source of solid row transfers
+static command_entry_t command_queue[COMMAND_QUEUE_SIZE];
+static volatile uint8_t command_head, command_tail; // task adds at the head, the interrupt sends the tail
+static volatile command_phase_t command_phase = COMMAND_IDLE;
+static volatile bool command_notify; // wake the display task once the queue is empty
+static volatile bool command_wake; // set by the interrupt, the task is woken on its way out
+static struct {
+    uint8_t* data;
+    uint16_t len;
+    bool continuous; // a continuous window waits for its stream
+} pending_pixels; // pixel transfer started when the command queue is empty
 static uint8_t active_buf_idx = 0; // 0 or 1
 static display_info_t display_info;
-
-// Color info
-static uint16_t fg;
-static uint16_t bg;
+static ili9341_scroll_t panel_scroll; // scroll region the panel is programmed with
+static ili9341_band_t panel_band; // band and idle mode the panel is in
+static bool band_leaving; // normal mode is due once the page being sent is out
+static bool band_changing; // the page being sent changed the band or idle mode
+static uint32_t frame_start; // cycle count when scanout took the page being sent
+static display_rotation_t render_rotation; // of the frames being rendered
+static display_rotation_t panel_rotation;  // the panel is programmed with
+static volatile bool panel_lost; // the watchdog dropped commands: panel modes and pixels are unknown
+
+// MADCTL per rotation: MV exchanges rows and columns, MX/MY mirror them, BGR panel.
+// The vertical scroll moves panel lines, which are columns only at DISPLAY_ROTATION_0.
+static const uint8_t rotation_madctl[DISPLAY_ROTATION_COUNT] = {0x28, 0x88, 0xE8, 0x48};
+
+#ifdef ILI9341_SCANOUT_PROFILE
+// Cycles spent sending frames, in the display task and in the DMA interrupt,
+// over the last second
+static struct {
+    uint32_t period_start;
+    uint32_t busy_cycles;
+    uint16_t frames;
+    uint16_t wakeups;       // display task runs
+} scanout_profile;
+#endif
+
+// Packed RGB565 pixel pairs for every combination of two palette indices
+#if ILI9341_BITS_PER_PIXEL > 1 && !ILI9341_DISPLAY_LIST
+static uint32_t pair_lut[PAIR_LUT_SIZE];
+#endif
+
+// 1 bpp rows are expanded by the fastest kernel of ili9341_expand.c on this core
+#if ILI9341_BITS_PER_PIXEL == 1 && !ILI9341_DISPLAY_LIST
+static expand_row_t expand_row; // set at init
+#endif
+static uint16_t pair_lut_palette[ILI9341_PALETTE_SIZE]; // in PANEL_COLOR order
+
+#if ILI9341_DISPLAY_LIST
+// Rasterizer of the display list pages, registered by the renderer
+static display_scanline_t scanline_source = NULL;
+#endif
 
 // Initialization command sequence
 static uint8_t init_commands[] = {
@@ -77,53 +201,263 @@ static uint8_t init_commands[] = {
     0xE1, 15, 0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1, 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F, // negative gamma correction
 };
 
+static uint16_t rotated_width(display_rotation_t rotation) {
+    return (rotation == DISPLAY_ROTATION_90 || rotation == DISPLAY_ROTATION_270) ? ILI9341_HEIGHT : ILI9341_WIDTH;
+}
+
+static uint16_t rotated_height(display_rotation_t rotation) {
+    return (rotation == DISPLAY_ROTATION_90 || rotation == DISPLAY_ROTATION_270) ? ILI9341_WIDTH : ILI9341_HEIGHT;
+}
+
+// Bytes per page row at a rotation
+static uint16_t rotated_stride(display_rotation_t rotation) {
+    return rotated_width(rotation) * ILI9341_BITS_PER_PIXEL / 8;
+}
+
+// Move a page from one state to another if nobody moved it first. The renderer
+// task, the display task and the DMA interrupt all change page states; the
+// exclusive load/store pair makes the check and the change one step, and a
+// store that raced another one is simply tried again.
+static bool change_page_state(ili9341_buffer_page_t* page, ili9341_buffer_state_t from,
+                              ili9341_buffer_state_t to) {
+    __DMB();    // what was written to the page is there before the new owner looks
+    do {
+        if (__LDREXB(&page->state) != from) {
+            __CLREX();
+            return false;
+        }
+    } while (__STREXB(to, &page->state));
+    return true;
+}
+
+// TIM4 watches the bus: every transfer started or finished restarts it, and
+// when ILI9341_WATCHDOG_MS pass without one its interrupt stops whatever hangs
+static void watchdog_kick(void) {
+    __HAL_TIM_SET_COUNTER(&htim4, 0);
+    if (!(htim4.Instance->CR1 & TIM_CR1_CEN)) {
+        __HAL_TIM_CLEAR_FLAG(&htim4, TIM_FLAG_UPDATE);
+        __HAL_TIM_ENABLE(&htim4);
+    }
+}
+
+static void watchdog_stop(void) {
+    __HAL_TIM_DISABLE(&htim4);
+}
+
 // Initialize DMA control structure
 static void reset_dma_control(void) {
-    if (dma_control.write_type == DMA_WRITE_FRAMEBUFFER) {
-        framebuffer.buffer_page[framebuffer.active_page].state = ILI9341_BUFFER_STATE_IDLE;
+    watchdog_stop();
+    ili9341_buffer_page_t* page = &framebuffer.buffer_page[framebuffer.active_page];
+    // Only scanout moves a page out of SCANNING
+    if (dma_control.write_type == DMA_WRITE_FRAMEBUFFER && page->state == ILI9341_BUFFER_STATE_SCANNING) {
+#if ILI9341_PAGE_COUNT == 1
+        // Single page: what was just sent is on the panel, start collecting the next frame
+        dirty_region_reset(&page->dirty);
+#endif
+        change_page_state(page, ILI9341_BUFFER_STATE_SCANNING, ILI9341_BUFFER_STATE_FREE);
     }
     dma_control.current_row = 0;
-    dma_control.wait_count = 0;
+    dma_control.rect_index = 0;
     dma_control.write_type = DMA_WRITE_NONE;
     dma_control.is_writing = false;
-    dma_control.is_row_completed = false;
-
+    dma_control.is_screen_done = false;
+    dma_control.timed_out = false;
+    dma_control.row_expanded = false;
+    dma_control.solid = false;
+#if ILI9341_CONTINUOUS_SCANOUT
+    // A transfer still running raises CS when it completes
+    dma_control.hold_cs = false;
+    if (!ili9341_spi_busy()) {
+        HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+    }
+#endif
 }
 
 // Framebuffer initialization
 static void init_framebuffer(void) {
     // Set initial page assignments
     framebuffer.render_page = 0;  // Page 0 is for rendering
-    framebuffer.active_page = 1;  // Page 1 is initially displayed
+    framebuffer.active_page = ILI9341_PAGE_COUNT - 1;  // Last page is initially displayed
+    framebuffer.newest_page = framebuffer.active_page;
 
-    // Initialize both buffer pages
-    for (int i = 0; i < 2; i++) {
-        framebuffer.buffer_page[i].state = ILI9341_BUFFER_STATE_IDLE;
+    // Initialize all buffer pages
+    for (int i = 0; i < ILI9341_PAGE_COUNT; i++) {
+        framebuffer.buffer_page[i].state = ILI9341_BUFFER_STATE_FREE;
+        framebuffer.buffer_page[i].rotation = render_rotation;
 
         memset(framebuffer.buffer_page[i].data, 0, ILI9341_FRAMEBUFFER_SIZE);
+#if !ILI9341_DISPLAY_LIST
+        memset(framebuffer.buffer_page[i].row_valid, 0, sizeof(framebuffer.buffer_page[i].row_valid));
+#endif
+
+        // The first frame of each page has to repaint the whole panel
+        dirty_region_reset(&framebuffer.buffer_page[i].dirty);
+        dirty_region_add(&framebuffer.buffer_page[i].dirty, 0, 0,
+                         rotated_width(render_rotation) - 1, rotated_height(render_rotation) - 1);
+
+#if ILI9341_USE_ATTRIBUTE_MAP
+        memset(framebuffer.buffer_page[i].attributes,
+               ILI9341_ATTRIBUTE(DISPLAY_PALETTE_FG, DISPLAY_PALETTE_BG), ILI9341_ATTRIBUTE_MAP_SIZE);
+#endif
     }
 }
 
-static bool swap_framebuffers(void) {
-    if (framebuffer.buffer_page[framebuffer.render_page].state == ILI9341_BUFFER_STATE_READY_TO_DISPLAY) {
-        portENTER_CRITICAL();
-        if (framebuffer.buffer_page[framebuffer.render_page].state == ILI9341_BUFFER_STATE_READY_TO_DISPLAY) { // double check
-            // Save current indices
-            uint8_t old_render_page = framebuffer.render_page;
-            uint8_t old_active_page = framebuffer.active_page;
+// Bring `dst` up to date with `src`, the frame the renderer finished last.
+// With two pages dst holds the frame src was drawn over, so only the rectangles
+// src touched differ, and merged dirty rectangles (which may cover pixels nobody
+// redrew) stay correct on the next frame.
+static void sync_page(ili9341_buffer_page_t* dst, const ili9341_buffer_page_t* src) {
+#if ILI9341_DISPLAY_LIST
+    // Every display list describes a whole frame, nothing carries over
+    (void)src;
+#elif ILI9341_PAGE_COUNT == 3
+    // dst may be two frames behind, and the frame in between dropped: copy it all
+    memcpy(dst->data, src->data, ILI9341_FRAMEBUFFER_SIZE);
+    memcpy(dst->row_valid, src->row_valid, sizeof(dst->row_valid));
+#if ILI9341_USE_ATTRIBUTE_MAP
+    memcpy(dst->attributes, src->attributes, ILI9341_ATTRIBUTE_MAP_SIZE);
+#endif
+#elif ILI9341_PAGE_COUNT == 2
+    uint16_t stride = rotated_stride(src->rotation);
+
+    // Rows the last frame drew for the first time are whole in src, and stale here
+    for (uint8_t word = 0; word < ILI9341_ROW_VALID_WORDS; ++word) {
+        uint32_t rows = src->row_valid[word] & ~dst->row_valid[word];
+        while (rows) {
+            uint32_t offset = (uint32_t)(word * 32 + __builtin_ctz(rows)) * stride;
+            memcpy(&dst->data[offset], &src->data[offset], stride);
+            rows &= rows - 1;
+        }
+    }
+    memcpy(dst->row_valid, src->row_valid, sizeof(dst->row_valid));
 
-            // Swap page indices
-            framebuffer.active_page = old_render_page;
-            framebuffer.render_page = old_active_page;
+    for (uint8_t i = 0; i < src->dirty.count; ++i) {
+        const dirty_rect_t* rect = &src->dirty.rects[i];
+        uint16_t first_byte = rect->x0 / ILI9341_PIXELS_PER_BYTE;
+        uint16_t byte_count = (rect->x1 / ILI9341_PIXELS_PER_BYTE) - first_byte + 1;
 
-            // Update buffer states
-            framebuffer.buffer_page[framebuffer.render_page].state = ILI9341_BUFFER_STATE_IDLE;
-            framebuffer.buffer_page[framebuffer.active_page].state = ILI9341_BUFFER_STATE_READY_TO_DISPLAY;
+        for (uint16_t row = rect->y0; row <= rect->y1; ++row) {
+            uint32_t offset = (uint32_t)row * stride + first_byte;
+            memcpy(&dst->data[offset], &src->data[offset], byte_count);
         }
-        portEXIT_CRITICAL();
-        return true;
     }
-    return false;
+
+#if ILI9341_USE_ATTRIBUTE_MAP
+    // Tiles recolored by the last frame are inside its dirty rectangles, the whole map is cheaper to copy
+    memcpy(dst->attributes, src->attributes, ILI9341_ATTRIBUTE_MAP_SIZE);
+#endif
+#endif
+    dirty_region_reset(&dst->dirty);
+}
+
+static uint8_t* start_rendering(uint8_t index) {
+    framebuffer.render_page = index;
+    // The next frame is rendered at the current rotation
+    framebuffer.buffer_page[index].rotation = render_rotation;
+    return framebuffer.buffer_page[index].data;
+}
+
+// Renderer side of the handoff. A free page other than the newest is caught up
+// with the newest and drawn into. Without one, the newest frame scanout has not
+// taken yet is opened again and the next frame drawn over it: that frame is never
+// sent on its own and counts as dropped. Display lists hold only their own
+// damage, every one of them has to reach the panel, so they wait instead.
+static uint8_t* begin_frame(void) {
+    ili9341_buffer_page_t* page = &framebuffer.buffer_page[framebuffer.render_page];
+    if (page->state == ILI9341_BUFFER_STATE_RENDERING) {
+        return page->data;  // begun earlier, nothing was drawn
+    }
+
+    // Scanout may free a page between the tries, it never takes one back
+    for (uint8_t attempt = 0; attempt < 2; ++attempt) {
+        uint8_t newest = framebuffer.newest_page;
+        ili9341_buffer_page_t* newest_page = &framebuffer.buffer_page[newest];
+
+#if ILI9341_DISPLAY_LIST
+        if (newest_page->state == ILI9341_BUFFER_STATE_READY) {
+            break;
+        }
+#endif
+        for (uint8_t i = 0; i < ILI9341_PAGE_COUNT; ++i) {
+            if (i != newest && change_page_state(&framebuffer.buffer_page[i], ILI9341_BUFFER_STATE_FREE,
+                                                 ILI9341_BUFFER_STATE_RENDERING)) {
+                sync_page(&framebuffer.buffer_page[i], newest_page);
+                return start_rendering(i);
+            }
+        }
+#if !ILI9341_DISPLAY_LIST
+        if (change_page_state(newest_page, ILI9341_BUFFER_STATE_READY, ILI9341_BUFFER_STATE_RENDERING)) {
+            frame_stats.frames_dropped++;
+            return start_rendering(newest);
+        }
+#endif
+#if ILI9341_PAGE_COUNT == 1
+        // Sent and still on the panel: draw on
+        if (change_page_state(newest_page, ILI9341_BUFFER_STATE_FREE, ILI9341_BUFFER_STATE_RENDERING)) {
+            return start_rendering(newest);
+        }
+#endif
+    }
+    frame_stats.render_stalls++;
+    return NULL;
+}
+
+// Hand the render page to scanout. With more than two pages, or when the renderer
+// took the free page ahead of scanout, the frame finished before may still be
+// waiting: it is dropped, and its rectangles go out with this one.
+static void end_frame(void) {
+    uint8_t index = framebuffer.render_page;
+    ili9341_buffer_page_t* page = &framebuffer.buffer_page[index];
+    if (page->state != ILI9341_BUFFER_STATE_RENDERING) {
+        return;
+    }
+
+#if ILI9341_PAGE_COUNT > 1 && !ILI9341_DISPLAY_LIST
+    ili9341_buffer_page_t* previous = &framebuffer.buffer_page[framebuffer.newest_page];
+    if (previous != page &&
+        change_page_state(previous, ILI9341_BUFFER_STATE_READY, ILI9341_BUFFER_STATE_FREE)) {
+        for (uint8_t i = 0; i < previous->dirty.count; ++i) {
+            const dirty_rect_t* rect = &previous->dirty.rects[i];
+            dirty_region_add(&page->dirty, rect->x0, rect->y0, rect->x1, rect->y1);
+        }
+        frame_stats.frames_dropped++;
+    }
+#endif
+    // The renderer may reassign palette entries for the next frame while this one waits
+    memcpy(page->palette, display_info.palette, sizeof(page->palette));
+    framebuffer.newest_page = index;
+    change_page_state(page, ILI9341_BUFFER_STATE_RENDERING, ILI9341_BUFFER_STATE_READY);
+}
+
+// After the watchdog dropped commands, forget what the panel was programmed
+// with: no value it can hold matches these, so the next apply_rotation,
+// apply_band and apply_scroll program it again. The page goes out whole, the
+// rectangles of the screen that was dropped are lost.
+static void recover_panel(ili9341_buffer_page_t* page) {
+    if (!panel_lost) {
+        return;
+    }
+    panel_lost = false;
+    panel_rotation = DISPLAY_ROTATION_COUNT;
+    memset(&panel_scroll, 0xFF, sizeof(panel_scroll));
+    panel_band.start = UINT16_MAX;
+    panel_band.size = 0;
+    panel_band.idle = !page->band.idle;
+    band_leaving = false;
+    dirty_region_add(&page->dirty, 0, 0, rotated_width(page->rotation) - 1, rotated_height(page->rotation) - 1);
+}
+
+// Scanout side: take the newest finished frame. The page sent before it was
+// freed when its last row went out.
+static bool take_ready_page(void) {
+    uint8_t newest = framebuffer.newest_page;
+    if (!change_page_state(&framebuffer.buffer_page[newest], ILI9341_BUFFER_STATE_READY,
+                           ILI9341_BUFFER_STATE_SCANNING)) {
+        return false;
+    }
+    framebuffer.active_page = newest;
+    recover_panel(&framebuffer.buffer_page[newest]);
+    return true;
 }
 
 // Initialize LCD controller state
@@ -134,104 +468,591 @@ static void reset_lcd_controller(void) {
 
     target_state = ILI9341_STATE_READY;
     init_timeout_ms = 0;
-    init_sequence_index = 0;
+    command_head = command_tail = 0;
 
     reset_dma_control();
     init_framebuffer();
+    memset(&panel_scroll, 0, sizeof(panel_scroll));
+    memset(&panel_band, 0, sizeof(panel_band));
+    band_leaving = band_changing = false;
+    panel_rotation = DISPLAY_ROTATION_0; // MADCTL of init_commands
 }
 
-static inline uint16_t get_pixel_color(uint8_t byte, uint8_t bit_pos) {
-    return (byte & (1 << bit_pos)) ? fg : bg;
+// Rebuild the pixel pair table when the palette of the page about to be sent
+// differs from the last one. At 1 bpp or with a display list only the palette
+// snapshot is kept.
+static void update_pair_lut(void) {
+    const uint16_t* palette = framebuffer.buffer_page[framebuffer.active_page].palette;
+    bool changed = false;
+    for (uint8_t i = 0; i < ILI9341_PALETTE_SIZE; ++i) {
+        uint16_t color = PANEL_COLOR(palette[i]);
+        if (pair_lut_palette[i] != color) {
+            pair_lut_palette[i] = color;
+            changed = true;
+        }
+    }
+    if (!changed) {
+        return;
+    }
+
+#if ILI9341_BITS_PER_PIXEL > 1 && !ILI9341_DISPLAY_LIST
+    // The left pixel sits in the high bits of the pair and goes out first (low halfword)
+    for (uint16_t pair = 0; pair < PAIR_LUT_SIZE; ++pair) {
+        uint16_t left = pair_lut_palette[pair >> ILI9341_BITS_PER_PIXEL];
+        uint16_t right = pair_lut_palette[pair & ILI9341_PIXEL_MASK];
+        pair_lut[pair] = (uint32_t)left | ((uint32_t)right << 16);
+    }
+#endif
 }
 
-// Draw zero screen
+#if ILI9341_BITS_PER_PIXEL == 1 && !ILI9341_DISPLAY_LIST
+// Time every expansion kernel on a row of the full width, colors changing every
+// few tiles as in a typical layout, and keep the fastest
+static void select_expand_kernel(void) {
+    uint8_t source[ILI9341_WIDTH / 8];
+    uint8_t attributes[ILI9341_WIDTH / 8];
+    uint32_t best_cycles = UINT32_MAX;
+    uint8_t best = EXPAND_KERNEL_PAIR;
+
+    for (uint8_t i = 0; i < sizeof(source); ++i) {
+        source[i] = (uint8_t)(i * 0x9D) ^ 0x5A;
+        attributes[i] = ILI9341_ATTRIBUTE(1 + (i / 4) % 3, DISPLAY_PALETTE_BG);
+    }
+
+    for (uint8_t kernel = 0; kernel < EXPAND_KERNEL_COUNT; ++kernel) {
+        uint32_t cycles = UINT32_MAX;
+        // Best of a few runs, the first one also warms the flash cache
+        for (uint8_t run = 0; run < 3; ++run) {
+            uint32_t start = cycle_counter_now();
+            expand_kernels[kernel](source, ILI9341_USE_ATTRIBUTE_MAP ? attributes : NULL, sizeof(source),
+                                   pair_lut_palette, (uint32_t*)line_buffer[0]);
+            uint32_t elapsed = cycle_counter_now() - start;
+            cycles = (elapsed < cycles) ? elapsed : cycles;
+        }
+        if (cycles < best_cycles) {
+            best_cycles = cycles;
+            best = kernel;
+        }
+    }
+    expand_row = expand_kernels[best];
+#ifdef ILI9341_SCANOUT_PROFILE
+    printf("scanout kernel: %s, %lu cycles per row\n", expand_kernel_names[best], (unsigned long)best_cycles);
+#endif
+}
+#endif
+
+// Expand the current row of the transfer window into RGB565.
+// Windows always start on an even column and span an even number of pixels.
 static void draw_screen(uint16_t* buffer, dma_write_type_t write_type) {
-    uint16_t row_offset = dma_control.current_row * ILI9341_BYTES_PER_ROW;
-    if (row_offset >= ILI9341_FRAMEBUFFER_SIZE - ILI9341_BYTES_PER_ROW) {
+    if (dma_control.current_row >= rotated_height(panel_rotation)) {
         return; // Prevent buffer overflow
     }
 
-    uint16_t send_index = 0;
-    fg = display_info.fg_color;
-    bg = display_info.bg_color;
+    uint32_t* out = (uint32_t*)buffer;
 
-    for (uint16_t byte_idx = 0; byte_idx < ILI9341_BYTES_PER_ROW; ++byte_idx) {
-        if (write_type == DMA_WRITE_CLEAR_SCREEN) {
-            buffer[send_index++] = 0x0000;
-        } else {
-            if (framebuffer.buffer_page[framebuffer.active_page].state == ILI9341_BUFFER_STATE_READY_TO_DISPLAY) {
-                uint8_t* source_buffer = &(framebuffer.buffer_page[framebuffer.active_page].data[0]);
-                uint8_t byte = source_buffer[row_offset + byte_idx];
-                for (int bit = 7; bit >= 0; --bit) {
-                    buffer[send_index++] = get_pixel_color(byte, bit);
-                }
+    if (write_type != DMA_WRITE_FRAMEBUFFER) {
+        for (uint16_t x = dma_control.window.x0; x <= dma_control.window.x1; x += 2) {
+            *out++ = 0x00000000;
+        }
+        return;
+    }
+
+    if (framebuffer.buffer_page[framebuffer.active_page].state == ILI9341_BUFFER_STATE_SCANNING) {
+#if ILI9341_DISPLAY_LIST
+        // The page holds commands, not pixels: rasterize just this row of the window
+        (void)out;
+        if (scanline_source) {
+            scanline_source(framebuffer.buffer_page[framebuffer.active_page].data, dma_control.current_row,
+                            dma_control.window.x0, dma_control.window.x1, pair_lut_palette, buffer);
+        }
+#else
+        if (!ILI9341_ROW_IS_VALID(framebuffer.buffer_page[framebuffer.active_page].row_valid,
+                                  dma_control.current_row)) {
+            // Not drawn since the page was invalidated: background, the page is not read
+            uint32_t background = pair_lut_palette[DISPLAY_PALETTE_BG] * 0x00010001u;
+            for (uint16_t x = dma_control.window.x0; x <= dma_control.window.x1; x += 2) {
+                *out++ = background;
             }
+            return;
         }
+
+        uint32_t row_offset = (uint32_t)dma_control.current_row * rotated_stride(panel_rotation);
+        const uint8_t* source_buffer = &(framebuffer.buffer_page[framebuffer.active_page].data[row_offset]);
+#if ILI9341_BITS_PER_PIXEL == 1
+        // A tile is one framebuffer byte wide: whole bytes go through the kernel,
+        // the partial ones at the window edges pair by pair
+        const uint8_t* attributes = NULL;
+#if ILI9341_USE_ATTRIBUTE_MAP
+        attributes = &framebuffer.buffer_page[framebuffer.active_page]
+                          .attributes[(dma_control.current_row / ILI9341_TILE_SIZE) *
+                                      (rotated_width(panel_rotation) / ILI9341_TILE_SIZE)];
+#endif
+        uint16_t x0 = dma_control.window.x0;
+        uint16_t x1 = dma_control.window.x1;
+        uint16_t first_byte = (x0 + 7) / 8;
+        uint16_t end_byte = (x1 + 1) / 8;
+
+        if (first_byte >= end_byte) {
+            expand_pixels(source_buffer, attributes, x0, x1, pair_lut_palette, out);
+            return;
+        }
+        if (x0 < first_byte * 8) {
+            out = expand_pixels(source_buffer, attributes, x0, first_byte * 8 - 1, pair_lut_palette, out);
+        }
+        expand_row(&source_buffer[first_byte], attributes ? &attributes[first_byte] : NULL,
+                   end_byte - first_byte, pair_lut_palette, out);
+        out += 4 * (end_byte - first_byte);
+        if (x1 >= end_byte * 8) {
+            expand_pixels(source_buffer, attributes, end_byte * 8, x1, pair_lut_palette, out);
+        }
+#else
+        for (uint16_t x = dma_control.window.x0; x <= dma_control.window.x1; x += 2) {
+            uint8_t byte = source_buffer[x / ILI9341_PIXELS_PER_BYTE];
+            uint8_t shift = (ILI9341_PIXELS_PER_BYTE - 2 - (x % ILI9341_PIXELS_PER_BYTE)) * ILI9341_BITS_PER_PIXEL;
+            *out++ = pair_lut[(byte >> shift) & PAIR_MASK];
+        }
+#endif
+#endif
     }
 }
 
-// Send data over SPI
-static HAL_StatusTypeDef send_data(ili9341_data_type_t type, uint8_t *data, uint16_t len, bool use_dma) {
-    if (!data || len == 0) return HAL_ERROR;
-    
-    HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_DC_PIN, 
-                     (type == ILI9341_DATA_COMMAND) ? GPIO_PIN_RESET : GPIO_PIN_SET);
+// Color of `row` of the window when it has a single one and needs no expansion:
+// cleared screens, rows not drawn since the page was invalidated, and at 1 bpp
+// rows whose window bits are all clear or all set over tiles of one color
+static bool solid_row_color(uint16_t row, uint16_t* color) {
+    if (dma_control.write_type != DMA_WRITE_FRAMEBUFFER) {
+        *color = 0x0000;
+        return true;
+    }
 
+#if ILI9341_DISPLAY_LIST
+    (void)row;
+    (void)color;
+    return false;
+#else
+    const ili9341_buffer_page_t* page = &framebuffer.buffer_page[framebuffer.active_page];
+    if (page->state != ILI9341_BUFFER_STATE_SCANNING) {
+        return false;
+    }
+    if (!ILI9341_ROW_IS_VALID(page->row_valid, row)) {
+        *color = pair_lut_palette[DISPLAY_PALETTE_BG];
+        return true;
+    }
+
+#if ILI9341_BITS_PER_PIXEL == 1
+    const uint8_t* source = &page->data[(uint32_t)row * rotated_stride(panel_rotation)];
+    uint16_t first = dma_control.window.x0 / 8;
+    uint16_t last = dma_control.window.x1 / 8;
+    uint8_t head_mask = 0xFF >> (dma_control.window.x0 % 8);
+    uint8_t tail_mask = 0xFF << (7 - dma_control.window.x1 % 8);
+    if (first == last) {
+        head_mask &= tail_mask;
+    }
+
+    uint8_t head = source[first] & head_mask;
+    if (head != 0 && head != head_mask) {
+        return false;
+    }
+    bool set = (head != 0);
+    for (uint16_t i = first + 1; i < last; ++i) {
+        if (source[i] != (set ? 0xFF : 0x00)) {
+            return false;
+        }
+    }
+    if (last != first && (source[last] & tail_mask) != (set ? tail_mask : 0)) {
+        return false;
+    }
+
+#if ILI9341_USE_ATTRIBUTE_MAP
+    const uint8_t* attributes =
+        &page->attributes[(row / ILI9341_TILE_SIZE) * (rotated_width(panel_rotation) / ILI9341_TILE_SIZE)];
+    *color = pair_lut_palette[set ? (attributes[first] >> 4) : (attributes[first] & 0x0F)];
+    for (uint16_t i = first + 1; i <= last; ++i) {
+        if (pair_lut_palette[set ? (attributes[i] >> 4) : (attributes[i] & 0x0F)] != *color) {
+            return false;
+        }
+    }
+#else
+    *color = pair_lut_palette[set ? DISPLAY_PALETTE_FG : DISPLAY_PALETTE_BG];
+#endif
+    return true;
+#else
+    return false;
+#endif
+#endif
+}
+
+// DMA items (SPI frames) in one row of the current transfer window
+static uint16_t window_row_size(void) {
+#if ILI9341_SPI_16BIT
+    return dma_control.window.x1 - dma_control.window.x0 + 1;
+#else
+    return (dma_control.window.x1 - dma_control.window.x0 + 1) * sizeof(uint16_t);
+#endif
+}
+
+// Start a pixel transfer; a solid run repeats one halfword
+static HAL_StatusTypeDef start_pixels(uint8_t* data, uint16_t len) {
+    watchdog_kick();
+#if ILI9341_SPI_16BIT
+    if (!ili9341_spi_set_frames(true)) {
+        return HAL_BUSY;
+    }
+#endif
+
+    HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_DC_PIN, GPIO_PIN_SET);
     HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+    return ili9341_spi_start(data, len, dma_control.solid) ? HAL_OK : HAL_BUSY;
+}
 
-    HAL_StatusTypeDef status = HAL_SPI_Transmit_DMA(&hspi2, data, len);
+static void command_next(void);
+#if ILI9341_CONTINUOUS_SCANOUT
+static bool start_continuous_stream(void);
+#endif
+
+// Put one transfer of the command at the queue tail on the bus. If it cannot
+// start nothing will complete, so the queue is dropped; a bus that stays busy
+// is left to the watchdog.
+static void command_transfer(GPIO_PinState dc, const uint8_t* data, uint16_t len) {
+    watchdog_kick();
+#if ILI9341_SPI_16BIT
+    if (!ili9341_spi_set_frames(false)) {
+        return;
+    }
+#endif
+    HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_DC_PIN, dc);
+    HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+    if (!ili9341_spi_start(data, len, false)) {
+        command_tail = command_head;
+        command_next();
+    }
+}
 
-    dma_control.multiple_byte = use_dma;
+// The queue is empty: hand the bus to the pixel transfer waiting for it
+static void command_drained(void) {
+    command_phase = COMMAND_IDLE;
+
+    // A transfer that does not start completes nothing, the watchdog ends its screen
+    if (pending_pixels.data) {
+        uint8_t* data = pending_pixels.data;
+        pending_pixels.data = NULL;
+        start_pixels(data, pending_pixels.len);
+#if ILI9341_CONTINUOUS_SCANOUT
+    } else if (pending_pixels.continuous) {
+        pending_pixels.continuous = false;
+        start_continuous_stream();
+#endif
+    } else {
+#if ILI9341_CONTINUOUS_SCANOUT
+        if (!dma_control.hold_cs)
+#endif
+        HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+        if (!dma_control.is_writing) {
+            watchdog_stop();
+        }
+    }
 
-    if (status != HAL_OK) {
-        // Log error (assuming a logging mechanism)
+    if (command_notify) {
+        command_notify = false;
+        command_wake = true;
     }
-    return status;
+}
 
+// Send the command at the queue tail, or finish when the queue is empty
+static void command_next(void) {
+    if (command_tail == command_head) {
+        command_drained();
+        return;
+    }
+    command_phase = COMMAND_OPCODE;
+    command_transfer(GPIO_PIN_RESET, &command_queue[command_tail].command, 1);
 }
 
-void ILI9341_Write_Command(uint8_t cmd)
-{
-    send_data(ILI9341_DATA_COMMAND, &cmd, 1, false);
+static void command_advance(void) {
+    command_tail = (command_tail + 1) % COMMAND_QUEUE_SIZE;
+    command_next();
 }
 
-void ILI9341_Write_Data(uint8_t data)
-{
-    send_data(ILI9341_DATA_PAYLOAD, &data, 1, false);
+static void command_wake_from_isr(void) {
+    if (!command_wake) return;
+    command_wake = false;
+
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    xEventGroupSetBitsFromISR(display_event, DISPLAY_EVENT_UPDATE, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
 
-// Send a single command
-static HAL_StatusTypeDef send_command(uint8_t cmd) {
-    return send_data(ILI9341_DATA_COMMAND, &cmd, 1, false);
+// DMA interrupt: a transfer of the command at the queue tail is out. Its
+// parameters follow, then its delay, then the next command.
+static void command_sent(void) {
+    const command_entry_t* entry = &command_queue[command_tail];
+
+    if (command_phase == COMMAND_OPCODE && entry->length > 0) {
+        command_phase = COMMAND_PAYLOAD;
+        command_transfer(GPIO_PIN_SET, entry->payload, entry->length);
+    } else if (entry->delay_ms > 0) {
+        command_phase = COMMAND_DELAY;
+        watchdog_kick();
+        __HAL_TIM_SET_AUTORELOAD(&htim3, entry->delay_ms * DELAY_TICKS_PER_MS - 1);
+        __HAL_TIM_SET_COUNTER(&htim3, 0);
+        __HAL_TIM_CLEAR_FLAG(&htim3, TIM_FLAG_UPDATE);
+        HAL_TIM_Base_Start_IT(&htim3);
+    } else {
+        command_advance();
+    }
+    command_wake_from_isr();
 }
 
-// Send data payload
-static HAL_StatusTypeDef send_payload(uint8_t *data, uint16_t len, bool use_dma) {
-    HAL_StatusTypeDef status = send_data(ILI9341_DATA_PAYLOAD, data, len, use_dma);
+// TIM3 interrupt: the delay of the command at the queue tail is over
+void ili9341_command_delay_elapsed(void) {
+    HAL_TIM_Base_Stop_IT(&htim3);
+    command_advance();
+    command_wake_from_isr();
+}
 
-    if (status != HAL_OK) {
-        reset_dma_control();
-        xSemaphoreGive(dma_semaphore);
+_Static_assert(FRAME_COMMANDS_MAX < COMMAND_QUEUE_SIZE && INIT_COMMANDS < COMMAND_QUEUE_SIZE,
+               "command bursts do not fit the command queue");
+
+// Add a command to the queue; the SPI/DMA interrupt sends it after the ones
+// before, toggling DC between command and parameters, and waits `delay_ms`
+// on TIM3 afterwards. `payload` must stay valid until it is sent. The row pump
+// queues window commands from the interrupt, into a queue it has emptied; the
+// task only queues between screens or with that interrupt masked, so no pixel
+// transfer is on the bus when an idle queue starts. A full queue is never waited for: the caller may be the interrupt or hold it
+// off, and the bursts above fit. Should it fill anyway the command is dropped.
+static void queue_command(uint8_t command, const uint8_t* payload, uint8_t length, uint16_t delay_ms) {
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    uint8_t next = (command_head + 1) % COMMAND_QUEUE_SIZE;
+    configASSERT(next != command_tail);
+    if (next == command_tail) {
+        taskEXIT_CRITICAL_FROM_ISR(saved);
+        return;
+    }
+
+    command_queue[command_head] = (command_entry_t){command, length, delay_ms, payload};
+    command_head = next;
+    bool start = (command_phase == COMMAND_IDLE);
+    if (start) {
+        command_phase = COMMAND_OPCODE;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+
+    if (start) {
+        command_next();
+        // In the interrupt the task is woken on its way out
+        if (command_wake && !xPortIsInsideInterrupt()) {
+            command_wake = false;
+            xEventGroupSetBits(display_event, DISPLAY_EVENT_UPDATE);
+        }
+    }
+}
+
+static bool command_queue_busy(void) {
+    return command_phase != COMMAND_IDLE;
+}
+
+// Send pixel rows by DMA. While panel commands are queued they wait, and the
+// interrupt starts them once the last one is out.
+static HAL_StatusTypeDef send_data(uint8_t *data, uint16_t len) {
+    if (!data || len == 0) return HAL_ERROR;
+
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    bool deferred = command_queue_busy();
+    if (deferred) {
+        pending_pixels.data = data;
+        pending_pixels.len = len;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+    return deferred ? HAL_OK : start_pixels(data, len);
+}
+
+// Send pixel rows. Runs in the task for the first rows of a screen and in the
+// interrupt for the others; a transfer that does not start completes nothing,
+// and the watchdog ends the screen.
+static void send_payload(uint8_t *data, uint16_t len) {
+    send_data(data, len);
+}
+
+// Send the rows from the current one on that share one solid color as a single
+// transfer of solid_color, the DMA memory address held still. False if the
+// current row has to be expanded.
+static bool send_solid_rows(void) {
+    uint16_t color;
+    if (!solid_row_color(dma_control.current_row, &color) || !SOLID_COLOR_SENDABLE(color)) {
+        return false;
+    }
+
+    uint16_t max_rows = SOLID_MAX_ITEMS / window_row_size();
+    uint16_t rows = 1;
+    uint16_t next;
+    while (dma_control.current_row + rows <= dma_control.window.y1 && rows < max_rows &&
+           solid_row_color(dma_control.current_row + rows, &next) && next == color) {
+        ++rows;
     }
 
-    return status;
+    solid_color = color;
+    dma_control.solid = true;
+    dma_control.row_expanded = false;
+    send_payload((uint8_t*)&solid_color, rows * window_row_size());
+    dma_control.current_row += rows;
+    return true;
 }
 
 // Set display RAM address window
-static void set_memory_window(void) {
-    uint16_t x0 = 0, x1 = 319;
-    uint16_t y0 = 0, y1 = 239;
+static void set_memory_window(const dirty_rect_t* window) {
+    // A window is only set once the previous one is out
+    static uint8_t column_addr[4];
+    static uint8_t row_addr[4];
+    uint16_t x0 = window->x0, x1 = window->x1;
+    uint16_t y0 = window->y0, y1 = window->y1;
+
+    column_addr[0] = x0 >> 8;
+    column_addr[1] = x0 & 0xFF;
+    column_addr[2] = x1 >> 8;
+    column_addr[3] = x1 & 0xFF;
+    row_addr[0] = y0 >> 8;
+    row_addr[1] = y0 & 0xFF;
+    row_addr[2] = y1 >> 8;
+    row_addr[3] = y1 & 0xFF;
+
+    queue_command(0x2A, column_addr, sizeof(column_addr), 0); // Column Address Set
+    queue_command(0x2B, row_addr, sizeof(row_addr), 0); // Page Address Set
+    queue_command(0x2C, NULL, 0, 0); // Memory Write
+}
 
-    uint8_t column_addr[4] = {x0 >> 8, x0 & 0xFF, x1 >> 8, x1 & 0xFF}; // 0 to 319
-    uint8_t row_addr[4] = {y0 >> 8, y0 & 0xFF, y1 >> 8, y1 & 0xFF};    // 0 to 239
-    
-    send_command(0x2A); // Column Address Set
-    send_payload(column_addr, 4, false);
-    
-    send_command(0x2B); // Page Address Set
-    send_payload(row_addr, 4, false);
-    
-    send_command(0x2C); // Memory Write
+// Program the scroll region of the page just sent. Its pixels are on the panel
+// already, so columns the new offset exposes never show stale content.
+static void apply_scroll(void) {
+    static uint8_t definition[6];
+    static uint8_t start_address[2];
+    const ili9341_scroll_t* scroll = &framebuffer.buffer_page[framebuffer.active_page].scroll;
+
+    if (memcmp(scroll, &panel_scroll, sizeof(panel_scroll)) == 0) {
+        return;
+    }
+
+    // Scrolling off is the whole panel as region, shown from its first line.
+    // The panel has ILI9341_WIDTH lines whatever the rotation.
+    uint16_t top = scroll->size ? scroll->start : 0;
+    uint16_t size = scroll->size ? scroll->size : ILI9341_WIDTH;
+    uint16_t bottom = ILI9341_WIDTH - top - size;
+    uint16_t address = top + scroll->offset;
+
+    definition[0] = top >> 8;
+    definition[1] = top & 0xFF;
+    definition[2] = size >> 8;
+    definition[3] = size & 0xFF;
+    definition[4] = bottom >> 8;
+    definition[5] = bottom & 0xFF;
+    start_address[0] = address >> 8;
+    start_address[1] = address & 0xFF;
+
+    queue_command(0x33, definition, sizeof(definition), 0); // Vertical Scrolling Definition
+    queue_command(0x37, start_address, sizeof(start_address), 0); // Vertical Scrolling Start Address
+
+    panel_scroll = *scroll;
+}
+
+// Turn the panel to the rotation the page was rendered at. Nothing on the panel
+// matches the new orientation, so the whole page is sent.
+static void apply_rotation(void) {
+    static uint8_t madctl;
+    ili9341_buffer_page_t* page = &framebuffer.buffer_page[framebuffer.active_page];
+
+    if (page->rotation == panel_rotation) {
+        return;
+    }
+
+    madctl = rotation_madctl[page->rotation];
+    queue_command(0x36, &madctl, 1, 0); // Memory Access Control
+    panel_rotation = page->rotation;
+
+    dirty_region_reset(&page->dirty);
+    dirty_region_add(&page->dirty, 0, 0, rotated_width(panel_rotation) - 1, rotated_height(panel_rotation) - 1);
+}
+
+// Put the panel in the band and idle mode of the page about to be sent. Only the
+// band was kept up to date on the panel: a moved band is sent whole, and leaving
+// it sends the whole page, normal mode follows once that is out (leave_band).
+// True when the panel changes mode.
+static bool apply_band(void) {
+    static uint8_t partial_area[4];
+    ili9341_buffer_page_t* page = &framebuffer.buffer_page[framebuffer.active_page];
+    const ili9341_band_t* band = &page->band;
+    bool changed = false;
+
+    if (band->start != panel_band.start || band->size != panel_band.size) {
+        uint16_t end = band->start + band->size - 1;
+
+        if (band->size == 0) {
+            dirty_region_add(&page->dirty, 0, 0, rotated_width(panel_rotation) - 1, rotated_height(panel_rotation) - 1);
+            band_leaving = true;
+        } else {
+            partial_area[0] = band->start >> 8;
+            partial_area[1] = band->start & 0xFF;
+            partial_area[2] = end >> 8;
+            partial_area[3] = end & 0xFF;
+            queue_command(0x30, partial_area, sizeof(partial_area), 0); // Partial Area
+            if (panel_band.size == 0 && !band_leaving) {
+                queue_command(0x12, NULL, 0, 0); // Partial Mode ON
+            } else {
+                dirty_region_add(&page->dirty, band->start, 0, end, rotated_height(panel_rotation) - 1);
+            }
+            band_leaving = false;
+        }
+        panel_band.start = band->start;
+        panel_band.size = band->size;
+        changed = true;
+    }
+
+    if (band->idle != panel_band.idle) {
+        queue_command(band->idle ? 0x39 : 0x38, NULL, 0, 0); // Idle Mode ON / OFF
+        panel_band.idle = band->idle;
+        changed = true;
+    }
+    return changed;
+}
+
+// The page that left the band is on the panel: show all of it
+static void leave_band(void) {
+    if (band_leaving) {
+        band_leaving = false;
+        queue_command(0x13, NULL, 0, 0); // Normal Display Mode ON
+    }
+}
+
+// Dirty rectangles of the page being sent from `rect_index` on, cut to the band
+// the panel shows; false when none is left in it
+static bool next_band_window(dirty_rect_t* window) {
+    const dirty_region_t* dirty = &framebuffer.buffer_page[framebuffer.active_page].dirty;
+    uint16_t last = panel_band.start + panel_band.size - 1;
+
+    for (; dma_control.rect_index < dirty->count; ++dma_control.rect_index) {
+        *window = dirty->rects[dma_control.rect_index];
+        if (panel_band.size == 0) {
+            return true;
+        }
+        if (window->x1 < panel_band.start || window->x0 > last) {
+            continue;
+        }
+        if (window->x0 < panel_band.start) window->x0 = panel_band.start;
+        if (window->x1 > last) window->x1 = last;
+        return true;
+    }
+    return false;
+}
+
+// Time the frame since scanout took its page; frames that changed the band are kept apart
+static void count_frame_cycles(void) {
+    uint32_t elapsed = cycle_counter_now() - frame_start;
+
+    if (band_changing) {
+        band_changing = false;
+        frame_stats.band_changes++;
+        frame_stats.band_change_cycles = elapsed;
+    } else {
+        frame_stats.frame_cycles = elapsed;
+    }
 }
 
 // Perform hardware reset
@@ -244,66 +1065,385 @@ static void hw_reset(void) {
     HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_RESET_PIN, GPIO_PIN_SET);
 }
 
-// Execute initialization command sequence
+// Queue the initialization command sequence, sleep out and its delay last; the
+// display task is woken once the panel is ready for pixels
 static void execute_init_sequence(void) {
-    init_sequence_index = 0;
-    while (init_sequence_index < sizeof(init_commands)) {
-        uint8_t cmd = init_commands[init_sequence_index++];
-        uint8_t len = init_commands[init_sequence_index++];
+    uint16_t index = 0;
+    while (index < sizeof(init_commands)) {
+        uint8_t cmd = init_commands[index++];
+        uint8_t len = init_commands[index++];
+
+        queue_command(cmd, &init_commands[index], len, (cmd == 0x01) ? ILI9341_SW_RESET_DELAY_MS : 0);
+        index += len;
+    }
+    command_notify = true;
+    queue_command(0x11, NULL, 0, ILI9341_SLEEP_OUT_DELAY_MS); // sleep out
+}
+
+#ifdef ILI9341_SCANOUT_PROFILE
+static void profile_busy(uint32_t start) {
+    scanout_profile.busy_cycles += cycle_counter_now() - start;
+}
+
+// Once a second: frames sent, share of the CPU scanout took, display task runs
+static void profile_frame_sent(void) {
+    uint32_t elapsed = cycle_counter_now() - scanout_profile.period_start;
+
+    scanout_profile.frames++;
+    if (elapsed >= SystemCoreClock) {
+        printf("scanout: %u fps, %lu%% CPU, %u task wakeups\n",
+               (unsigned)((uint64_t)scanout_profile.frames * SystemCoreClock / elapsed),
+               (unsigned long)((uint64_t)scanout_profile.busy_cycles * 100 / elapsed),
+               (unsigned)scanout_profile.wakeups);
+
+        ili9341_spi_profile_t spi;
+        ili9341_spi_take_profile(&spi);
+        if (spi.transfers) {
+            printf("spi: %lu transfers, %lu cycles to start, %lu in the interrupt (%lu waiting for the bus)\n",
+                   (unsigned long)spi.transfers, (unsigned long)(spi.start_cycles / spi.transfers),
+                   (unsigned long)(spi.irq_cycles / spi.transfers), (unsigned long)(spi.drain_cycles / spi.transfers));
+        }
+        memset(&scanout_profile, 0, sizeof(scanout_profile));
+        scanout_profile.period_start = cycle_counter_now();
+    }
+}
+#endif
+
+static void pump_rows(void);
+
+#if ILI9341_CONTINUOUS_SCANOUT
+// Expand the row after the ones queued so far into `buffer`. Past the window the
+// first row is expanded again: the DMA may send part of it before it is stopped,
+// and the panel wraps back to that row, so only the same pixels are written again.
+static void expand_queued_row(uint16_t* buffer) {
+    uint16_t row = dma_control.current_row;
+    if (row > dma_control.window.y1) {
+        dma_control.current_row = dma_control.window.y0;
+    }
+    draw_screen(buffer, dma_control.write_type);
+    dma_control.current_row = row + 1;
+}
+
+// Stop the stream and go on with the next window
+static void finish_continuous_window(void) {
+    ili9341_spi_stop();
+
+    dma_control.current_row = dma_control.window.y1 + 1;
+    pump_rows();
+    command_wake_from_isr();
+}
+
+// DMA interrupt: `sent` went out and the other line buffer is being sent now
+static void continuous_row_sent(uint16_t* sent) {
+#ifdef ILI9341_SCANOUT_PROFILE
+    uint32_t start = cycle_counter_now();
+#endif
+    watchdog_kick();
+    if (++dma_control.rows_sent > dma_control.window.y1 - dma_control.window.y0) {
+        finish_continuous_window();
+    } else {
+        expand_queued_row(sent);
+    }
+#ifdef ILI9341_SCANOUT_PROFILE
+    profile_busy(start);
+#endif
+}
+
+void ili9341_dma_buffer_sent(uint8_t buffer) {
+    continuous_row_sent(line_buffer[buffer]);
+}
+
+// The rest of the window is lost; the frame goes on with the next one
+void ili9341_dma_stream_error(void) {
+    finish_continuous_window();
+}
+
+// Start the stream over both line buffers; the command queue is empty
+static bool start_continuous_stream(void) {
+    watchdog_kick();
+#if ILI9341_SPI_16BIT
+    if (!ili9341_spi_set_frames(true)) {
+        return false;
+    }
+#endif
+
+    HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+    return ili9341_spi_start_double(line_buffer[0], line_buffer[1], window_row_size());
+}
+
+// Queue the next two rows of the window and let the DMA interrupt pump the others
+static bool start_continuous_window(void) {
+    if (dma_control.current_row != dma_control.window.y0) {
+        // The rows above went out as a solid run: what is left becomes the
+        // window, so the guard row wraps back to its first row
+        dma_control.window.y0 = dma_control.current_row;
+        set_memory_window(&dma_control.window);
+    }
+    expand_queued_row(line_buffer[0]);
+    expand_queued_row(line_buffer[1]);
+    dma_control.rows_sent = 0;
+    dma_control.row_expanded = false;
+
+    // Memory Write must be out before DC selects data: while commands are
+    // queued, the interrupt starts the stream once the last one is out
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    bool deferred = command_queue_busy();
+    pending_pixels.continuous = deferred;
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+
+    if (!deferred && !start_continuous_stream()) {
+        dma_control.current_row = dma_control.window.y0;
+        return false;
+    }
+    return true;
+}
+#endif
+
+// Send the next rows of the window: a run of solid rows in one transfer, else
+// the rest of the window continuously or the current row alone. The row after
+// a single one is expanded while that one is on the bus.
+static void send_rows(void) {
+    if (send_solid_rows()) {
+        return;
+    }
+
+#if ILI9341_CONTINUOUS_SCANOUT
+    if (dma_control.window.x1 - dma_control.window.x0 + 1 >= CONTINUOUS_MIN_WIDTH && start_continuous_window()) {
+        return;
+    }
+#endif
+
+    if (!dma_control.row_expanded) {
+        if (dma_control.write_type == DMA_WRITE_FRAMEBUFFER) {
+            DRAW_FRAME_BUFFER();
+        } else {
+            DRAW_CLEAR_SCREEN();
+        }
+    }
+
+    SWAP_LINE_BUFFERS();
+    send_payload((uint8_t*)CURRENT_DMA_LINE_BUFFER, window_row_size());
+    dma_control.current_row++;
 
-        send_command(cmd);
-        if (len > 0) {
-            send_payload(&init_commands[init_sequence_index], len, false);
-            init_sequence_index += len;
+    dma_control.row_expanded = (dma_control.current_row <= dma_control.window.y1);
+    if (dma_control.row_expanded) {
+        if (dma_control.write_type == DMA_WRITE_FRAMEBUFFER) {
+            DRAW_FRAME_BUFFER();
+        } else {
+            DRAW_CLEAR_SCREEN();
         }
     }
 }
 
+// Program the panel window and send its first rows
+static void start_window(const dirty_rect_t* window) {
+    dma_control.window = *window;
+    dma_control.current_row = window->y0;
+    dma_control.row_expanded = false;
+    dma_control.is_writing = true;
+    dma_control.is_screen_done = false;
+
+    set_memory_window(window);
+    send_rows();
+}
+
+// First window of a screen, from the task. The interrupts that pump rows and
+// commands share dma_control and the queue, so they are masked at the NVIC until
+// the window is under way; every other interrupt and the scheduler keep running
+// while its first rows are expanded.
+static void start_screen(const dirty_rect_t* window) {
+    NVIC_DisableIRQ(DMA1_Stream4_IRQn);
+    NVIC_DisableIRQ(TIM3_IRQn);
+    NVIC_DisableIRQ(TIM4_IRQn);
+    start_window(window);
+    NVIC_EnableIRQ(TIM4_IRQn);
+    NVIC_EnableIRQ(TIM3_IRQn);
+    NVIC_EnableIRQ(DMA1_Stream4_IRQn);
+}
+
+// DMA interrupt: the rows started last are out. The next rows of the window and
+// the next windows of the frame start from here, the display task only ends
+// the screen.
+static void pump_rows(void) {
+    dma_control.solid = false;
+
+    if (dma_control.current_row <= dma_control.window.y1) {
+        send_rows();
+        return;
+    }
+
+#if ILI9341_CONTINUOUS_SCANOUT
+    // The last bytes of a continuous window may still be shifting out. A bus
+    // that stays busy is stuck: the watchdog ends the screen.
+    if (!ili9341_spi_wait_idle()) {
+        return;
+    }
+#endif
+    if (dma_control.write_type == DMA_WRITE_FRAMEBUFFER) {
+        dirty_rect_t window;
+        dma_control.rect_index++;
+        if (next_band_window(&window)) {
+            start_window(&window);
+            return;
+        }
+    }
+    dma_control.is_screen_done = true;
+    command_wake = true;
+}
+
+// A rendered page is waiting to be shown
+static bool page_waiting(void) {
+    return framebuffer.buffer_page[framebuffer.newest_page].state == ILI9341_BUFFER_STATE_READY;
+}
+
+static void frame_timer_callback(TimerHandle_t timer) {
+    (void)timer;
+    xEventGroupSetBits(display_event, DISPLAY_EVENT_UPDATE);
+}
+
+#if ILI9341_REFRESH_INTERVAL_MS
+// Send the shown page again, whole, unless the renderer took it for a new frame
+static void refresh_screen(void) {
+    ili9341_buffer_page_t* page = &framebuffer.buffer_page[framebuffer.active_page];
+    dirty_rect_t window;
+
+    if (xSemaphoreTake(dma_semaphore, portMAX_DELAY) != pdTRUE) return;
+    if (!change_page_state(page, ILI9341_BUFFER_STATE_FREE, ILI9341_BUFFER_STATE_SCANNING)) {
+        xSemaphoreGive(dma_semaphore);
+        return;
+    }
+#if ILI9341_CONTINUOUS_SCANOUT
+    dma_control.hold_cs = true;
+#endif
+    dirty_region_reset(&page->dirty);
+    // Commands dropped by the watchdog since the page was sent: program it again
+    if (panel_lost) {
+        recover_panel(page);
+        apply_rotation();
+        band_changing = apply_band();
+    }
+    dirty_region_add(&page->dirty, 0, 0, rotated_width(panel_rotation) - 1, rotated_height(panel_rotation) - 1);
+
+    dma_control.write_type = DMA_WRITE_FRAMEBUFFER;
+    dma_control.rect_index = 0;
+    frame_stats.refreshes++;
+    last_frame_tick = xTaskGetTickCount();
+    frame_start = cycle_counter_now();
+    next_band_window(&window); // the whole screen meets any band
+    start_screen(&window);
+}
+#endif
+
 // Start drawing a screen (initial, clear, or framebuffer)
 static void start_screen_draw(void) {
+    const dirty_rect_t full_screen = {0, 0, rotated_width(panel_rotation) - 1, rotated_height(panel_rotation) - 1};
+
     if (xSemaphoreTake(dma_semaphore, portMAX_DELAY) == pdTRUE) {
-        set_memory_window();
-        
+#if ILI9341_CONTINUOUS_SCANOUT
+        dma_control.hold_cs = true;
+#endif
         if (dma_control.write_type == DMA_WRITE_FRAMEBUFFER) {
-            if (swap_framebuffers() == true) {
-                DRAW_FRAME_BUFFER();
+            dirty_rect_t window;
+            frame_start = cycle_counter_now();
+
+            // Nothing new to show in the band: leave the panel pixels untouched
+            bool taken = take_ready_page();
+            if (taken) {
+                apply_rotation();
+                band_changing = apply_band();
+            }
+            dma_control.rect_index = 0;
+            if (taken == false || !next_band_window(&window)) {
+                if (taken) {
+                    apply_scroll();
+                    frame_stats.frames_skipped++;
+                    if (band_changing) {
+                        count_frame_cycles();
+                    }
+                }
+                reset_dma_control();
+                xSemaphoreGive(dma_semaphore);
+                return;
             }
+            update_pair_lut();
+            last_frame_tick = xTaskGetTickCount();
+            start_screen(&window);
         } else {
-            DRAW_CLEAR_SCREEN();
+            start_screen(&full_screen);
         }
-
-        SWAP_LINE_BUFFERS();
-        send_payload((uint8_t*)CURRENT_DMA_LINE_BUFFER, ILI9341_LINE_BUFFER_SIZE, true);
-        dma_control.is_writing = true;
-        dma_control.current_row = 1;
     } else {
         printf("Semaphore timeout in start_screen_draw\n");
     }
 }
 
-// Draw the next row
-static void draw_next_row(void) {
-    if (dma_control.current_row >= ILI9341_HEIGHT) {
-        xSemaphoreGive(dma_semaphore);
-        if (dma_control.write_type == DMA_WRITE_INIT_SCREEN) {
-            init_state = ILI9341_INIT_BACKLIGHT;
-        } else if (dma_control.write_type == DMA_WRITE_CLEAR_SCREEN) {
-            current_state = ILI9341_STATE_STOPPING;
+// Scanout on demand: only a rendered page starts a frame, no sooner than
+// FRAME_INTERVAL_MS after the last one. Wakeups for anything else cost no SPI.
+static void scanout_if_due(void) {
+    TickType_t since_last = xTaskGetTickCount() - last_frame_tick;
+
+    if (!page_waiting()) {
+        // The held page was dropped or taken: a later one has to arm the timer again
+        frame_held = false;
+#if ILI9341_REFRESH_INTERVAL_MS
+        if (since_last >= pdMS_TO_TICKS(ILI9341_REFRESH_INTERVAL_MS)) {
+            refresh_screen();
+        }
+#endif
+        return;
+    }
+
+    if (since_last < pdMS_TO_TICKS(FRAME_INTERVAL_MS)) {
+        if (!frame_held) {
+            frame_held = true;
+            frame_stats.frames_throttled++;
+            xTimerChangePeriod(frame_timer, pdMS_TO_TICKS(FRAME_INTERVAL_MS) - since_last, 0);
         }
+        return;
+    }
+    frame_held = false;
+
+    dma_control.write_type = DMA_WRITE_FRAMEBUFFER;
+    start_screen_draw();
+}
+
+// The interrupt sent the last window of the screen, or the watchdog stopped it
+static void finish_screen_draw(void) {
+    if (dma_control.timed_out) {
+        printf("DMA timeout for row %d, screen dropped\n", dma_control.current_row);
+        band_changing = false;
         reset_dma_control();
+        xSemaphoreGive(dma_semaphore);
         return;
     }
-    
+
     if (dma_control.write_type == DMA_WRITE_FRAMEBUFFER) {
-        DRAW_FRAME_BUFFER();
-    } else {
-        DRAW_CLEAR_SCREEN();
+        apply_scroll();
+        leave_band();
     }
 
-    SWAP_LINE_BUFFERS();
-    send_payload((uint8_t*)CURRENT_DMA_LINE_BUFFER, ILI9341_LINE_BUFFER_SIZE, true);
-    dma_control.is_row_completed = false;
-    dma_control.current_row++;
+    xSemaphoreGive(dma_semaphore);
+    if (dma_control.write_type == DMA_WRITE_INIT_SCREEN) {
+        init_state = ILI9341_INIT_BACKLIGHT;
+    } else if (dma_control.write_type == DMA_WRITE_CLEAR_SCREEN) {
+        current_state = ILI9341_STATE_STOPPING;
+    } else if (dma_control.write_type == DMA_WRITE_FRAMEBUFFER) {
+        frame_stats.frames_sent++;
+        count_frame_cycles();
+        // The next page may have been rendered while this one was sent
+        if (page_waiting()) {
+            xEventGroupSetBits(display_event, DISPLAY_EVENT_UPDATE);
+        }
+#if ILI9341_REFRESH_INTERVAL_MS
+        else {
+            xTimerChangePeriod(frame_timer, pdMS_TO_TICKS(ILI9341_REFRESH_INTERVAL_MS), 0);
+        }
+#endif
+#ifdef ILI9341_SCANOUT_PROFILE
+        profile_frame_sent();
+#endif
+    }
+    reset_dma_control();
 }
 
 // Check initialization timeout
@@ -326,14 +1466,11 @@ void init_timeout_callback(TimerHandle_t timer) {
         break;
 
     case ILI9341_INIT_SLEEP_OUT:
-        xEventGroupSetBits(display_event, DISPLAY_EVENT_UPDATE);
+        // The command queue wakes the task once the sequence and its delays are done
         break;
     
     case ILI9341_INIT_SCREEN:
-        if (has_timeout_expired(ILI9341_SLEEP_OUT_DELAY_MS))
-        {
-            xEventGroupSetBits(display_event, DISPLAY_EVENT_UPDATE);
-        }
+        xEventGroupSetBits(display_event, DISPLAY_EVENT_UPDATE);
         break; 
 
     case ILI9341_INIT_BACKLIGHT:
@@ -366,23 +1503,23 @@ static void process_initialization(void) {
         break;
 
     case ILI9341_INIT_SLEEP_OUT:
-        send_command(0x11); // sleep out
-        init_state = ILI9341_INIT_SCREEN;
+        if (!command_queue_busy())
+        {
+            init_state = ILI9341_INIT_SCREEN;
+        }
         break;
 
     case ILI9341_INIT_SCREEN:
-        if (has_timeout_expired(ILI9341_SLEEP_OUT_DELAY_MS))
-        {
-            dma_control.write_type = DMA_WRITE_INIT_SCREEN;
-            start_screen_draw();
-        }
+        dma_control.write_type = DMA_WRITE_INIT_SCREEN;
+        start_screen_draw();
         break;
 
     case ILI9341_INIT_BACKLIGHT:
         HAL_GPIO_WritePin(LD2_GPIO_Port, LCD_BACKLIGHT_PIN, GPIO_PIN_SET);
-        send_command(0x29); // set backlight
+        queue_command(0x29, NULL, 0, 0); // display on
         current_state = ILI9341_STATE_RUNNING;
         init_state = ILI9341_INIT_COMPLETED;
+        xTimerStop(init_timer, 0); // from now on only frames wake the task
         xEventGroupSetBits(display_event, DISPLAY_EVENT_UPDATE);
         break;
 
@@ -397,18 +1534,29 @@ static void process_initialization(void) {
     }
 }
 
-// Handle DMA timeout
-static void handle_dma_timeout(void) {
-    if (dma_control.wait_count >= ILI9341_DMA_TIMEOUT_COUNT) {
-        reset_dma_control();
-        if (dma_semaphore) {
-            xSemaphoreGive(dma_semaphore); // Release on timeout
-        }
-        printf("DMA timeout for row %d, count: %d, resetting dma_control\n", 
-               dma_control.current_row, dma_control.wait_count);
-    } else {
-        dma_control.wait_count++;
+// TIM4 interrupt: nothing completed for ILI9341_WATCHDOG_MS, however busy the
+// tasks are. The bus is stopped wherever it hangs, queued commands are dropped
+// and the display task ends the screen. The next page taken programs the panel
+// modes again and is sent whole (take_ready_page).
+void ili9341_watchdog_expired(void) {
+    panel_lost = true;
+    watchdog_stop();
+    ili9341_spi_stop();
+    HAL_TIM_Base_Stop_IT(&htim3);
+    command_tail = command_head;
+    pending_pixels.data = NULL;
+#if ILI9341_CONTINUOUS_SCANOUT
+    pending_pixels.continuous = false;
+#endif
+    command_phase = COMMAND_IDLE;
+    HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+
+    if (dma_control.is_writing) {
+        dma_control.timed_out = true;
+        dma_control.is_screen_done = true;
     }
+    command_wake = true;
+    command_wake_from_isr();
 }
 
 // Initialize the ILI9341 driver
@@ -418,7 +1566,7 @@ static void ili9341_driver_init(void) {
     
     reset_lcd_controller();
     
-    TimerHandle_t init_timer = xTimerCreate(
+    init_timer = xTimerCreate(
         "ILI9341InitTimer",
         pdMS_TO_TICKS(1),
         pdTRUE,
@@ -431,6 +1579,19 @@ static void ili9341_driver_init(void) {
     } else {
         // Log timer creation failure
     }
+    frame_timer = xTimerCreate("ILI9341FrameTimer", 1, pdFALSE, NULL, frame_timer_callback);
+    // The SPI layer bounds its waits on the cycle counter
+    cycle_counter_init();
+    ili9341_spi_init();
+
+    __HAL_TIM_SET_AUTORELOAD(&htim4, ILI9341_WATCHDOG_MS * WATCHDOG_TICKS_PER_MS - 1);
+    // HAL_TIM_Base_Init left UIF set with its update event
+    __HAL_TIM_CLEAR_FLAG(&htim4, TIM_FLAG_UPDATE);
+    __HAL_TIM_ENABLE_IT(&htim4, TIM_IT_UPDATE);
+
+#if ILI9341_BITS_PER_PIXEL == 1 && !ILI9341_DISPLAY_LIST
+    select_expand_kernel();
+#endif
 
     dma_semaphore = xSemaphoreCreateBinary();
     if (dma_semaphore) {
@@ -451,13 +1612,12 @@ static void ili9341_driver_init(void) {
 //     }
 // }
 
-// Main controller task
-void ili9341_controller_task(void) {
+// One step of the controller, run by the display task on each event
+static void controller_step(void) {
     if (dma_control.is_writing) {
-        if (dma_control.is_row_completed) {
-            draw_next_row();
-        } else {
-            handle_dma_timeout();
+        // Rows and windows are pumped by the DMA interrupt
+        if (dma_control.is_screen_done) {
+            finish_screen_draw();
         }
         return;
     }
@@ -475,8 +1635,7 @@ void ili9341_controller_task(void) {
     case ILI9341_STATE_RUNNING:
         if (dma_control.is_writing != true)
         {
-            dma_control.write_type = DMA_WRITE_FRAMEBUFFER;
-            start_screen_draw();
+            scanout_if_due();
         }
         break;
 
@@ -490,26 +1649,133 @@ void ili9341_controller_task(void) {
     }
 }
 
+// Main controller task
+void ili9341_controller_task(void) {
+#ifdef ILI9341_SCANOUT_PROFILE
+    uint32_t start = cycle_counter_now();
+    scanout_profile.wakeups++;
+    controller_step();
+    profile_busy(start);
+#else
+    controller_step();
+#endif
+}
+
+// Mark a region of the render page as touched by the renderer
+static void update_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    uint16_t width = rotated_width(render_rotation);
+    uint16_t height = rotated_height(render_rotation);
+    if (w == 0 || h == 0 || x >= width || y >= height) return;
+
+    uint16_t x1 = (x + w > width) ? (width - 1) : (x + w - 1);
+    uint16_t y1 = (y + h > height) ? (height - 1) : (y + h - 1);
+
+    // Scanout works on pixel pairs: widen to an even start and an odd end column
+    x &= ~1u;
+    x1 |= 1u;
+
+    dirty_region_add(&framebuffer.buffer_page[framebuffer.render_page].dirty, x, y, x1, y1);
+}
+
+// Scroll region of the render page, programmed when the page has been sent
+static void set_scroll(uint16_t start, uint16_t size, uint16_t offset) {
+    ili9341_scroll_t* scroll = &framebuffer.buffer_page[framebuffer.render_page].scroll;
+
+    if (render_rotation != DISPLAY_ROTATION_0 || start >= ILI9341_WIDTH || size == 0) {
+        start = size = offset = 0;
+    } else if (start + size > ILI9341_WIDTH) {
+        size = ILI9341_WIDTH - start;
+    }
+
+    scroll->start = start;
+    scroll->size = size;
+    scroll->offset = size ? (offset % size) : 0;
+}
+
+// Band and idle mode of the render page, the panel takes them when the page is sent.
+// The band is in panel lines, which are columns only at DISPLAY_ROTATION_0.
+static void set_band(uint16_t start, uint16_t size, bool idle) {
+    ili9341_band_t* band = &framebuffer.buffer_page[framebuffer.render_page].band;
+
+    if (render_rotation != DISPLAY_ROTATION_0 || start >= ILI9341_WIDTH || size == 0) {
+        start = size = 0;
+    } else {
+        // Scanout works on pixel pairs: widen to an even start and an odd end column
+        uint16_t end = (start + size > ILI9341_WIDTH) ? (ILI9341_WIDTH - 1) : (start + size - 1);
+        start &= ~1u;
+        size = (end | 1u) - start + 1;
+    }
+
+    band->start = start;
+    band->size = size;
+    band->idle = idle;
+}
+
+#if ILI9341_DISPLAY_LIST
+static void set_scanline_source(display_scanline_t source) {
+    scanline_source = source;
+}
+#endif
+
+// Frame counters since init
+static void get_stats(display_stats_t* stats) {
+    taskENTER_CRITICAL();
+    *stats = frame_stats;
+    taskEXIT_CRITICAL();
+}
+
+// Frames from now on are rendered at `rotation`; the render page was just begun
+static void set_rotation(display_rotation_t rotation) {
+    if (rotation >= DISPLAY_ROTATION_COUNT) {
+        return;
+    }
+
+    render_rotation = rotation;
+    framebuffer.buffer_page[framebuffer.render_page].rotation = rotation;
+
+    display_info.width = rotated_width(rotation);
+    display_info.height = rotated_height(rotation);
+    display_info.stride = rotated_stride(rotation);
+    display_info.column_scroll = (rotation == DISPLAY_ROTATION_0);
+}
+
 // Get framebuffer pointer
 static display_info_t* get_framebuffer(void) {
     display_info.data = (uint8_t*)&framebuffer;
     display_info.size = ILI9341_FRAMEBUFFER_SIZE;
-    display_info.fg_color = fg;
-    display_info.bg_color = bg;
+    display_info.palette_size = ILI9341_PALETTE_SIZE;
+    display_info.width = rotated_width(render_rotation);
+    display_info.height = rotated_height(render_rotation);
+    display_info.stride = rotated_stride(render_rotation);
+    display_info.column_scroll = (render_rotation == DISPLAY_ROTATION_0);
 
     return &display_info;
 }
 
 // DMA completion callback
 void ili9341_dma_complete(void) {
+    if (command_queue_busy()) {
+        command_sent();
+        return;
+    }
+
+#if ILI9341_CONTINUOUS_SCANOUT
+    if (!dma_control.hold_cs)
+#endif
     HAL_GPIO_WritePin(LCD_GPIO_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-    dma_control.is_row_completed = true;
-    if (dma_control.multiple_byte)
-    {
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xEventGroupSetBitsFromISR(display_event, DISPLAY_EVENT_UPDATE, &xHigherPriorityTaskWoken);
-        portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+    if (!dma_control.is_writing || dma_control.is_screen_done) {
+        return;
     }
+
+#ifdef ILI9341_SCANOUT_PROFILE
+    uint32_t start = cycle_counter_now();
+#endif
+    watchdog_kick();
+    pump_rows();
+    command_wake_from_isr();
+#ifdef ILI9341_SCANOUT_PROFILE
+    profile_busy(start);
+#endif
 }
 
 // static void test_display(void)
@@ -522,7 +1788,17 @@ void ili9341_dma_complete(void) {
 static const display_driver_t ili9341_driver = {
     .init = ili9341_driver_init,
     // .update = test_display,
-    .get_framebuffer = get_framebuffer
+    .update_window = update_window,
+    .get_framebuffer = get_framebuffer,
+    .set_scroll = set_scroll,
+    .set_band = set_band,
+    .set_rotation = set_rotation,
+    .begin_frame = begin_frame,
+    .end_frame = end_frame,
+    .get_stats = get_stats,
+#if ILI9341_DISPLAY_LIST
+    .set_scanline_source = set_scanline_source,
+#endif
 };
 
 // Get driver instance
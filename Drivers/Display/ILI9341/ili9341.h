@@ -2,14 +2,134 @@
 #define ILI9341_H
 
 #include "dev_display.h"
+#include "dirty_region.h"
 
-// Display dimensions and buffer configuration
+// Display dimensions and buffer configuration, at DISPLAY_ROTATION_0 (landscape).
+// Rotating by 90 or 270 degrees swaps them in display_info_t; pages hold the same
+// number of pixels either way.
 #define ILI9341_WIDTH                   320
 #define ILI9341_HEIGHT                  240
+
+// Display list mode: pages hold the drawing commands of a frame instead of pixels,
+// and each row is rasterized into the line buffer right before its DMA
+// (see layout_display_list.h). Pixel values are 4 bit palette indices.
+#ifndef ILI9341_DISPLAY_LIST
+#define ILI9341_DISPLAY_LIST            0
+#endif
+
+#if ILI9341_DISPLAY_LIST && !defined(ILI9341_BITS_PER_PIXEL)
+#define ILI9341_BITS_PER_PIXEL          4
+#endif
+
+// Framebuffer depth, palette indexed: 1, 2 or 4 bits per pixel (override with -DILI9341_BITS_PER_PIXEL=n)
+#ifndef ILI9341_BITS_PER_PIXEL
 #define ILI9341_BITS_PER_PIXEL          1
+#endif
+
+#if (ILI9341_BITS_PER_PIXEL != 1) && (ILI9341_BITS_PER_PIXEL != 2) && (ILI9341_BITS_PER_PIXEL != 4)
+#error "ILI9341_BITS_PER_PIXEL must be 1, 2 or 4"
+#endif
+
+#if ILI9341_DISPLAY_LIST && (ILI9341_BITS_PER_PIXEL != 4)
+#error "ILI9341_DISPLAY_LIST requires ILI9341_BITS_PER_PIXEL == 4"
+#endif
+
+#if ILI9341_DISPLAY_LIST
+#ifndef ILI9341_DISPLAY_LIST_SIZE
+#define ILI9341_DISPLAY_LIST_SIZE       3072
+#endif
+#define ILI9341_FRAMEBUFFER_SIZE        ILI9341_DISPLAY_LIST_SIZE
+#else
 #define ILI9341_FRAMEBUFFER_SIZE        (ILI9341_WIDTH * ILI9341_HEIGHT * ILI9341_BITS_PER_PIXEL / 8)
-#define ILI9341_BYTES_PER_ROW           (ILI9341_WIDTH * ILI9341_BITS_PER_PIXEL /8)
+#endif
+#define ILI9341_BYTES_PER_ROW           (ILI9341_WIDTH * ILI9341_BITS_PER_PIXEL /8)    // landscape, see display_info_t.stride
 #define ILI9341_LINE_BUFFER_SIZE        (ILI9341_WIDTH * 2)
+#define ILI9341_PIXELS_PER_BYTE         (8 / ILI9341_BITS_PER_PIXEL)
+#define ILI9341_PIXEL_MASK              ((1 << ILI9341_BITS_PER_PIXEL) - 1)
+
+// Continuous scanout: the rows of a window go out back to back. DMA1_Stream4 runs in
+// double-buffer mode over both line buffers, its transfer-complete interrupt expands
+// the next row into the buffer just sent, and CS stays low for the whole frame.
+// Off, the display task starts every row. Build with -DILI9341_SCANOUT_PROFILE to
+// print frames per second and the CPU time scanout takes, for either mode.
+#ifndef ILI9341_CONTINUOUS_SCANOUT
+#define ILI9341_CONTINUOUS_SCANOUT      0
+#endif
+
+// Pixel rows go out as 16-bit SPI frames with halfword DMA: colors stay in native
+// RGB565 order and a row takes half the DMA items. Commands and their parameters
+// are still sent as bytes. Build with -DILI9341_SPI_16BIT=0 to send rows as bytes
+// too; the palette is then swapped to panel byte order whenever it changes.
+#ifndef ILI9341_SPI_16BIT
+#define ILI9341_SPI_16BIT               1
+#endif
+
+// Per-tile colors for 1bpp: every 8x8 tile stores a foreground and a background
+// palette index (fg in the high nibble) applied at scanout. Disable with
+// -DILI9341_USE_ATTRIBUTE_MAP=0 to get the plain two color framebuffer.
+#ifndef ILI9341_USE_ATTRIBUTE_MAP
+#define ILI9341_USE_ATTRIBUTE_MAP       (ILI9341_BITS_PER_PIXEL == 1)
+#endif
+
+#if ILI9341_USE_ATTRIBUTE_MAP && (ILI9341_BITS_PER_PIXEL != 1)
+#error "ILI9341_USE_ATTRIBUTE_MAP requires ILI9341_BITS_PER_PIXEL == 1"
+#endif
+
+#define ILI9341_TILE_SIZE               8
+#define ILI9341_TILE_COLUMNS            (ILI9341_WIDTH / ILI9341_TILE_SIZE)
+#define ILI9341_TILE_ROWS               (ILI9341_HEIGHT / ILI9341_TILE_SIZE)
+#define ILI9341_ATTRIBUTE_MAP_SIZE      (ILI9341_TILE_COLUMNS * ILI9341_TILE_ROWS)
+#define ILI9341_ATTRIBUTE(fg, bg)       ((uint8_t)((((fg) & 0x0F) << 4) | ((bg) & 0x0F)))
+
+#if ILI9341_USE_ATTRIBUTE_MAP
+#define ILI9341_PALETTE_SIZE            16
+#else
+#define ILI9341_PALETTE_SIZE            (1 << ILI9341_BITS_PER_PIXEL)
+#endif
+
+// Deeper pages do not fit twice in RAM (4bpp is 38.4 KB), so they run single
+// buffered: the renderer waits for scanout, which only sends dirty rectangles.
+// Display lists are small enough to double buffer at any depth. 1bpp pages can
+// take a third page (ILI9341_TRIPLE_BUFFER), so a finished frame is always there
+// for scanout while the next one is drawn; it costs another 11 KB of RAM.
+#ifndef ILI9341_TRIPLE_BUFFER
+#define ILI9341_TRIPLE_BUFFER           0
+#endif
+
+#if ILI9341_TRIPLE_BUFFER && (ILI9341_BITS_PER_PIXEL != 1 || ILI9341_DISPLAY_LIST)
+#error "ILI9341_TRIPLE_BUFFER is for 1bpp pixel pages"
+#endif
+
+#if ILI9341_TRIPLE_BUFFER
+#define ILI9341_PAGE_COUNT              3
+#elif ILI9341_BITS_PER_PIXEL == 1 || ILI9341_DISPLAY_LIST
+#define ILI9341_PAGE_COUNT              2
+#else
+#define ILI9341_PAGE_COUNT              1
+#endif
+
+// Scanout only runs for a rendered page waiting to be shown, at most ILI9341_MAX_FPS
+// frames a second (0: no limit). With ILI9341_REFRESH_INTERVAL_MS above 0 the shown
+// page is sent again, whole, when nothing was sent for that long, repainting a panel
+// that lost its contents; 0 keeps an idle screen off the bus.
+#ifndef ILI9341_MAX_FPS
+#define ILI9341_MAX_FPS                 60
+#endif
+#ifndef ILI9341_REFRESH_INTERVAL_MS
+#define ILI9341_REFRESH_INTERVAL_MS     0
+#endif
+
+#if ILI9341_REFRESH_INTERVAL_MS && ILI9341_PAGE_COUNT == 1
+#error "ILI9341_REFRESH_INTERVAL_MS needs a double buffered build: a single page may be half rendered"
+#endif
+
+// One bit per page row, set once the renderer has drawn the row since the page was
+// last invalidated. Other rows hold stale pixels and scanout sends them as
+// background. A rotated page is ILI9341_WIDTH rows high.
+#if !ILI9341_DISPLAY_LIST
+#define ILI9341_ROW_VALID_WORDS         ((ILI9341_WIDTH + 31) / 32)
+#define ILI9341_ROW_IS_VALID(rows, row) (((rows)[(row) / 32] >> ((row) % 32)) & 1u)
+#endif
 
 // Initialization states for display setup
 typedef enum {
@@ -37,24 +157,62 @@ typedef enum {
     ILI9341_DATA_PAYLOAD
 } ili9341_data_type_t;
 
+// Page ownership. The renderer moves pages FREE -> RENDERING -> READY, scanout
+// READY -> SCANNING -> FREE; each step is one exclusive store, no lock is taken.
 typedef enum {
-    ILI9341_BUFFER_STATE_IDLE = 0,
-    ILI9341_BUFFER_STATE_READY_TO_DISPLAY,
+    ILI9341_BUFFER_STATE_FREE = 0,
+    ILI9341_BUFFER_STATE_RENDERING,
+    ILI9341_BUFFER_STATE_READY,
+    ILI9341_BUFFER_STATE_SCANNING,
 } ili9341_buffer_state_t;
 
+// Hardware scroll region (VSCRDEF/VSCRSADD). Panel lines run along the screen x
+// axis in landscape (MADCTL MV), so the region is a band of columns and the
+// panel scrolls it horizontally, wrapping around.
+typedef struct {
+    uint16_t start;     // first column of the region
+    uint16_t size;      // columns in the region, 0 when scrolling is off
+    uint16_t offset;    // region column shown at the left edge of the region
+} ili9341_scroll_t;
+
+// Active band (PTLAR/PTLON) and idle mode (IDMON). The band is a range of panel
+// lines like the scroll region, so columns in landscape; the panel scans and
+// shows only those, the rest of the screen is blank.
+typedef struct {
+    uint16_t start;     // first column of the band
+    uint16_t size;      // columns in the band, 0 for the whole screen (normal mode)
+    bool idle;          // 8 colors, one bit per channel
+} ili9341_band_t;
+
 typedef struct {
-    ili9341_buffer_state_t state;    /**< Current state of the buffer page. */
+    volatile uint8_t state;          /**< ili9341_buffer_state_t, changed with LDREXB/STREXB. */
     uint8_t data[ILI9341_FRAMEBUFFER_SIZE]; /**< Framebuffer for the page. */
+    dirty_region_t dirty;            /**< Regions touched since the page was last synced. */
+    ili9341_scroll_t scroll;         /**< Scroll region to program once the page is on the panel. */
+    ili9341_band_t band;             /**< Band and idle mode the page is shown with. */
+    uint16_t palette[ILI9341_PALETTE_SIZE]; /**< Palette the page was rendered with, taken by end_frame. */
+    display_rotation_t rotation;     /**< Rotation the page was rendered at. */
+#if !ILI9341_DISPLAY_LIST
+    uint32_t row_valid[ILI9341_ROW_VALID_WORDS]; /**< Rows drawn since the page was invalidated. */
+#endif
+#if ILI9341_USE_ATTRIBUTE_MAP
+    uint8_t attributes[ILI9341_ATTRIBUTE_MAP_SIZE]; /**< Per-tile fg/bg palette indices. */
+#endif
 } ili9341_buffer_page_t;
 
 typedef struct {
-    uint8_t render_page;
-    uint8_t active_page;
-    ili9341_buffer_page_t buffer_page[2];   /**< Array of two buffer pages for double buffering. */
+    uint8_t render_page;                /**< Page the renderer draws into, its own. */
+    uint8_t active_page;                /**< Page scanout sends or sent last, its own. */
+    volatile uint8_t newest_page;       /**< Last page the renderer finished. */
+    ili9341_buffer_page_t buffer_page[ILI9341_PAGE_COUNT];   /**< Buffer pages, up to three. */
 } ili9341_display_buffer_t;
 
 // Function prototypes
 void ili9341_controller_task(void);
+// TIM3 update interrupt: a delay of the panel command queue is over
+void ili9341_command_delay_elapsed(void);
+// TIM4 update interrupt: scanout or the command queue hung, see ILI9341_WATCHDOG_MS
+void ili9341_watchdog_expired(void);
 const display_driver_t* ili9341_get_driver(void);
 
 #endif /* ILI9341_H */
\ No newline at end of file
@@ -0,0 +1,140 @@
+// CMSIS only for the SIMD intrinsics: the kernels also build on the host (Tools/expand_bench.c)
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include "stm32f4xx.h"
+#endif
+#include "ili9341_expand.h"
+
+// Attribute of pages without an attribute map: foreground 1 on background 0
+#define PLAIN_ATTRIBUTE     0x10
+
+// Pixel pair of two bits (left one high) as a halfword mask, left pixel low
+static const uint32_t pair_masks[4] = {0x00000000, 0xFFFF0000, 0x0000FFFF, 0xFFFFFFFF};
+
+static inline uint8_t attribute_at(const uint8_t* attributes, uint16_t index) {
+    return attributes ? attributes[index] : PLAIN_ATTRIBUTE;
+}
+
+// Both colors of a tile repeated in the two halfwords
+static inline void tile_colors(const uint16_t* palette, uint8_t attribute, uint32_t* fg, uint32_t* bg) {
+    *fg = palette[attribute >> 4] * 0x00010001u;
+    *bg = palette[attribute & 0x0F] * 0x00010001u;
+}
+
+static void build_pair_lut(uint32_t* lut, const uint16_t* palette, uint8_t attribute) {
+    uint32_t fg, bg;
+    tile_colors(palette, attribute, &fg, &bg);
+
+    for (uint8_t pair = 0; pair < 4; ++pair) {
+        lut[pair] = (fg & pair_masks[pair]) | (bg & ~pair_masks[pair]);
+    }
+}
+
+static void expand_pairs(const uint8_t* source, const uint8_t* attributes, uint16_t count,
+                         const uint16_t* palette, uint32_t* out) {
+    uint32_t lut[4];
+    uint16_t cached_attribute = 0xFFFF;
+
+    for (uint16_t i = 0; i < count; ++i) {
+        uint8_t attribute = attribute_at(attributes, i);
+        if (attribute != cached_attribute) {
+            build_pair_lut(lut, palette, attribute);
+            cached_attribute = attribute;
+        }
+
+        uint8_t byte = source[i];
+        out[0] = lut[byte >> 6];
+        out[1] = lut[(byte >> 4) & 3];
+        out[2] = lut[(byte >> 2) & 3];
+        out[3] = lut[byte & 3];
+        out += 4;
+    }
+}
+
+// Costs 32 stores per color change, pays off on runs of same colored tiles
+static void expand_nibbles(const uint8_t* source, const uint8_t* attributes, uint16_t count,
+                           const uint16_t* palette, uint32_t* out) {
+    uint32_t lut[16][2];
+    uint16_t cached_attribute = 0xFFFF;
+
+    for (uint16_t i = 0; i < count; ++i) {
+        uint8_t attribute = attribute_at(attributes, i);
+        if (attribute != cached_attribute) {
+            uint32_t pairs[4];
+            build_pair_lut(pairs, palette, attribute);
+            for (uint8_t nibble = 0; nibble < 16; ++nibble) {
+                lut[nibble][0] = pairs[nibble >> 2];
+                lut[nibble][1] = pairs[nibble & 3];
+            }
+            cached_attribute = attribute;
+        }
+
+        const uint32_t* high = lut[source[i] >> 4];
+        const uint32_t* low = lut[source[i] & 0x0F];
+        out[0] = high[0];
+        out[1] = high[1];
+        out[2] = low[0];
+        out[3] = low[1];
+        out += 4;
+    }
+}
+
+// Masks are 0x00 or 0xFF per byte: adding one to itself carries exactly in the
+// set bytes, so GE flags the foreground bytes for __SEL. Without the DSP
+// extension the same select is done with logic operations.
+static inline uint32_t select_pair(uint32_t mask, uint32_t fg, uint32_t bg) {
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+    (void)__UADD8(mask, mask);
+    return __SEL(fg, bg);
+#else
+    return bg ^ ((fg ^ bg) & mask);
+#endif
+}
+
+static void expand_select(const uint8_t* source, const uint8_t* attributes, uint16_t count,
+                          const uint16_t* palette, uint32_t* out) {
+    uint32_t fg = 0, bg = 0;
+    uint16_t cached_attribute = 0xFFFF;
+
+    for (uint16_t i = 0; i < count; ++i) {
+        uint8_t attribute = attribute_at(attributes, i);
+        if (attribute != cached_attribute) {
+            tile_colors(palette, attribute, &fg, &bg);
+            cached_attribute = attribute;
+        }
+
+        uint8_t byte = source[i];
+        out[0] = select_pair(pair_masks[byte >> 6], fg, bg);
+        out[1] = select_pair(pair_masks[(byte >> 4) & 3], fg, bg);
+        out[2] = select_pair(pair_masks[(byte >> 2) & 3], fg, bg);
+        out[3] = select_pair(pair_masks[byte & 3], fg, bg);
+        out += 4;
+    }
+}
+
+const expand_row_t expand_kernels[EXPAND_KERNEL_COUNT] = {
+    [EXPAND_KERNEL_PAIR] = expand_pairs,
+    [EXPAND_KERNEL_NIBBLE] = expand_nibbles,
+    [EXPAND_KERNEL_SELECT] = expand_select,
+};
+
+const char* const expand_kernel_names[EXPAND_KERNEL_COUNT] = {
+    [EXPAND_KERNEL_PAIR] = "pair table",
+    [EXPAND_KERNEL_NIBBLE] = "nibble table",
+    [EXPAND_KERNEL_SELECT] = "byte select",
+};
+
+uint32_t* expand_pixels(const uint8_t* source, const uint8_t* attributes, uint16_t x0, uint16_t x1,
+                        const uint16_t* palette, uint32_t* out) {
+    uint32_t fg = 0, bg = 0;
+    uint16_t cached_attribute = 0xFFFF;
+
+    for (uint16_t x = x0; x <= x1; x += 2) {
+        uint8_t attribute = attribute_at(attributes, x / 8);
+        if (attribute != cached_attribute) {
+            tile_colors(palette, attribute, &fg, &bg);
+            cached_attribute = attribute;
+        }
+        *out++ = select_pair(pair_masks[(source[x / 8] >> (6 - (x % 8))) & 3], fg, bg);
+    }
+    return out;
+}
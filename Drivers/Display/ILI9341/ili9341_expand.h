@@ -0,0 +1,38 @@
+#ifndef ILI9341_EXPAND_H
+#define ILI9341_EXPAND_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Row expansion of 1 bpp pages into RGB565, two pixels per 32-bit word with the
+ * left pixel in the low halfword (it goes out first). A set bit takes the
+ * foreground of its 8 pixel tile, a clear bit its background. `attributes` holds
+ * one attribute per source byte (foreground in the high nibble, see
+ * ILI9341_ATTRIBUTE); NULL colors every pixel with palette entries 1 and 0.
+ *
+ * The kernels only differ in speed; the driver times them at init and keeps the
+ * fastest for the build and the core it runs on.
+ */
+
+typedef enum {
+    EXPAND_KERNEL_PAIR = 0,     // 4-entry pixel pair table, rebuilt when the tile colors change
+    EXPAND_KERNEL_NIBBLE,       // 16-entry table of 4 pixels, two 32-bit stores per lookup
+    EXPAND_KERNEL_SELECT,       // constant pair masks, colors picked by a SIMD byte select
+    EXPAND_KERNEL_COUNT,
+} expand_kernel_t;
+
+// `count` whole source bytes (8 pixels each) into 4 * count words of `out`
+typedef void (*expand_row_t)(const uint8_t* source, const uint8_t* attributes, uint16_t count,
+                             const uint16_t* palette, uint32_t* out);
+
+extern const expand_row_t expand_kernels[EXPAND_KERNEL_COUNT];
+extern const char* const expand_kernel_names[EXPAND_KERNEL_COUNT];
+
+// Pixels x0..x1 of a row (x0 even, x1 odd) for the parts of a window that do not
+// cover whole bytes; `source` and `attributes` point at the start of the row.
+// Returns the word after the last one written.
+uint32_t* expand_pixels(const uint8_t* source, const uint8_t* attributes, uint16_t x0, uint16_t x1,
+                        const uint16_t* palette, uint32_t* out);
+
+#endif /* ILI9341_EXPAND_H */
@@ -0,0 +1,173 @@
+#include "main.h"
+#include "cycle_counter.h"
+#include "ili9341_spi.h"
+
+#define SPI_PANEL           SPI2
+#define DMA_PANEL           DMA1_Stream4
+
+// Stream 4 flags of DMA1 HISR, cleared at the same positions in HIFCR
+#define STREAM_FLAGS        (DMA_HISR_TCIF4 | DMA_HISR_HTIF4 | DMA_HISR_TEIF4 | DMA_HISR_DMEIF4 | DMA_HISR_FEIF4)
+
+// The last frames leave SPI2 within a few microseconds. A bus still busy after
+// this long is stuck; the waits give up and leave it to the driver watchdog,
+// which runs at the same priority as the DMA interrupt and could not preempt them.
+#define IDLE_TIMEOUT_US     100
+
+static bool halfword_frames;
+
+#ifdef ILI9341_SCANOUT_PROFILE
+static ili9341_spi_profile_t spi_profile;
+#endif
+
+void ili9341_spi_init(void) {
+    CLEAR_BIT(DMA_PANEL->CR, DMA_SxCR_EN);
+    while (DMA_PANEL->CR & DMA_SxCR_EN) {
+    }
+    DMA1->HIFCR = STREAM_FLAGS;
+
+    // Direct mode, memory to SPI2, as HAL_DMA_Init left it; only completion and
+    // transfer errors interrupt
+    DMA_PANEL->PAR = (uint32_t)&SPI_PANEL->DR;
+    CLEAR_BIT(DMA_PANEL->FCR, DMA_SxFCR_FEIE);
+    MODIFY_REG(DMA_PANEL->CR, DMA_SxCR_HTIE | DMA_SxCR_DMEIE, DMA_SxCR_TCIE | DMA_SxCR_TEIE);
+
+    halfword_frames = (SPI_PANEL->CR1 & SPI_CR1_DFF) != 0;
+    SET_BIT(SPI_PANEL->CR1, SPI_CR1_SPE);
+}
+
+// Until the last item has left DR and the shift register
+bool ili9341_spi_busy(void) {
+    return (DMA_PANEL->CR & DMA_SxCR_EN) || !(SPI_PANEL->SR & SPI_SR_TXE) || (SPI_PANEL->SR & SPI_SR_BSY);
+}
+
+// Counted on the DWT cycle counter, which the driver starts before any transfer
+bool ili9341_spi_wait_idle(void) {
+    uint32_t start = cycle_counter_now();
+    uint32_t budget = SystemCoreClock / 1000000 * IDLE_TIMEOUT_US;
+
+    while (ili9341_spi_busy()) {
+        if (cycle_counter_now() - start > budget) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// DFF and the stream sizes only change with both stopped and the last frame out
+bool ili9341_spi_set_frames(bool halfword) {
+    if (halfword == halfword_frames) return true;
+
+    if (!ili9341_spi_wait_idle()) {
+        return false;
+    }
+    CLEAR_BIT(SPI_PANEL->CR1, SPI_CR1_SPE);
+    MODIFY_REG(SPI_PANEL->CR1, SPI_CR1_DFF, halfword ? SPI_CR1_DFF : 0);
+    MODIFY_REG(DMA_PANEL->CR, DMA_SxCR_PSIZE | DMA_SxCR_MSIZE,
+               halfword ? (DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0) : 0);
+    SET_BIT(SPI_PANEL->CR1, SPI_CR1_SPE);
+
+    halfword_frames = halfword;
+    return true;
+}
+
+// The stream is enabled before SPI2 requests: TXE is set, the first item goes at once
+bool ili9341_spi_start(const void* data, uint16_t items, bool repeat) {
+#ifdef ILI9341_SCANOUT_PROFILE
+    uint32_t start = cycle_counter_now();
+#endif
+    if (DMA_PANEL->CR & DMA_SxCR_EN) {
+        return false;
+    }
+
+    DMA1->HIFCR = STREAM_FLAGS;
+    MODIFY_REG(DMA_PANEL->CR, DMA_SxCR_DBM | DMA_SxCR_CT | DMA_SxCR_MINC, repeat ? 0 : DMA_SxCR_MINC);
+    DMA_PANEL->NDTR = items;
+    DMA_PANEL->M0AR = (uint32_t)data;
+    SET_BIT(DMA_PANEL->CR, DMA_SxCR_EN);
+    SET_BIT(SPI_PANEL->CR2, SPI_CR2_TXDMAEN);
+
+#ifdef ILI9341_SCANOUT_PROFILE
+    spi_profile.transfers++;
+    spi_profile.start_cycles += cycle_counter_now() - start;
+#endif
+    return true;
+}
+
+bool ili9341_spi_start_double(const void* m0, const void* m1, uint16_t items) {
+    if (DMA_PANEL->CR & DMA_SxCR_EN) {
+        return false;
+    }
+
+    DMA1->HIFCR = STREAM_FLAGS;
+    MODIFY_REG(DMA_PANEL->CR, DMA_SxCR_CT, DMA_SxCR_DBM | DMA_SxCR_MINC);
+    DMA_PANEL->NDTR = items;
+    DMA_PANEL->M0AR = (uint32_t)m0;
+    DMA_PANEL->M1AR = (uint32_t)m1;
+    SET_BIT(DMA_PANEL->CR, DMA_SxCR_EN);
+    SET_BIT(SPI_PANEL->CR2, SPI_CR2_TXDMAEN);
+    return true;
+}
+
+// Disabling the stream raises TCIF; it is cleared here, an interrupt already
+// pending finds no flag
+void ili9341_spi_stop(void) {
+    CLEAR_BIT(SPI_PANEL->CR2, SPI_CR2_TXDMAEN);
+    CLEAR_BIT(DMA_PANEL->CR, DMA_SxCR_EN);
+    while (DMA_PANEL->CR & DMA_SxCR_EN) {
+    }
+    DMA1->HIFCR = STREAM_FLAGS;
+}
+
+// The stream disables itself after the last item, which is then still in SPI2.
+// A transfer error, or a last item that never leaves, completes nothing: the
+// driver watchdog ends that transfer.
+void ili9341_spi_dma_irq(void) {
+#ifdef ILI9341_SCANOUT_PROFILE
+    uint32_t start = cycle_counter_now();
+#endif
+    uint32_t flags = DMA1->HISR & STREAM_FLAGS;
+    DMA1->HIFCR = flags;
+
+#if ILI9341_CONTINUOUS_SCANOUT
+    if (DMA_PANEL->CR & DMA_SxCR_DBM) {
+        if (flags & DMA_HISR_TEIF4) {
+            ili9341_spi_stop();
+            ili9341_dma_stream_error();
+        } else if ((flags & DMA_HISR_TCIF4) && (DMA_PANEL->CR & DMA_SxCR_EN)) {
+            // CT names the buffer the stream went on with
+            ili9341_dma_buffer_sent((DMA_PANEL->CR & DMA_SxCR_CT) ? 0 : 1);
+        }
+        return;
+    }
+#endif
+    if (!(flags & DMA_HISR_TCIF4)) {
+        return;
+    }
+
+    CLEAR_BIT(SPI_PANEL->CR2, SPI_CR2_TXDMAEN);
+#ifdef ILI9341_SCANOUT_PROFILE
+    uint32_t drain = cycle_counter_now();
+#endif
+    bool drained = ili9341_spi_wait_idle();
+    // Nothing reads the receive side: clear the overrun it ran into
+    (void)SPI_PANEL->DR;
+    (void)SPI_PANEL->SR;
+
+#ifdef ILI9341_SCANOUT_PROFILE
+    uint32_t now = cycle_counter_now();
+    spi_profile.drain_cycles += now - drain;
+    spi_profile.irq_cycles += now - start;
+#endif
+    if (drained) {
+        ili9341_dma_complete();
+    }
+}
+
+#ifdef ILI9341_SCANOUT_PROFILE
+void ili9341_spi_take_profile(ili9341_spi_profile_t* profile) {
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    *profile = spi_profile;
+    memset(&spi_profile, 0, sizeof(spi_profile));
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+}
+#endif
@@ -0,0 +1,50 @@
+#ifndef ILI9341_SPI_H
+#define ILI9341_SPI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Transfers to the panel on SPI2 TX, DMA1_Stream4 channel 0, by register.
+ * HAL sets both peripherals up (SPI2_Init, HAL_SPI_MspInit); from
+ * ili9341_spi_init() on the driver owns them and HAL is not called for
+ * transfers, nor its DMA and SPI interrupt handlers. DC and CS stay with the driver.
+ *
+ * `items` counts DMA items: bytes, or halfwords once ili9341_spi_set_frames(true).
+ */
+
+void ili9341_spi_init(void);
+// Byte frames for commands or halfword frames for pixels; waits for the bus to be
+// idle, false if it stays busy (nothing changed)
+bool ili9341_spi_set_frames(bool halfword);
+// One transfer, `repeat` sends the first item `items` times. False if the stream is busy.
+bool ili9341_spi_start(const void* data, uint16_t items, bool repeat);
+// Double-buffer stream over m0 and m1, `items` each, until ili9341_spi_stop()
+bool ili9341_spi_start_double(const void* m0, const void* m1, uint16_t items);
+// Stop the stream wherever it is; nothing completes
+void ili9341_spi_stop(void);
+bool ili9341_spi_busy(void);
+// Wait for the bus to be idle, at most about 100 us; false if it is stuck
+bool ili9341_spi_wait_idle(void);
+
+// DMA1_Stream4 interrupt
+void ili9341_spi_dma_irq(void);
+
+// Called from the interrupt, implemented by the driver
+void ili9341_dma_complete(void);                // a transfer is out, SPI2 idle
+void ili9341_dma_buffer_sent(uint8_t buffer);   // double buffer: `buffer` is out, the other one going
+void ili9341_dma_stream_error(void);            // double buffer: transfer error, the stream stopped
+
+#ifdef ILI9341_SCANOUT_PROFILE
+// Cycles the layer spent per transfer since the last call
+typedef struct {
+    uint32_t transfers;
+    uint32_t start_cycles;      // programming the stream
+    uint32_t irq_cycles;        // interrupt entry to the driver callback
+    uint32_t drain_cycles;      // of irq_cycles: waiting for the last frame to leave SPI2
+} ili9341_spi_profile_t;
+
+void ili9341_spi_take_profile(ili9341_spi_profile_t* profile);
+#endif
+
+#endif /* ILI9341_SPI_H */
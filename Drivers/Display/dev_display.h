@@ -1,18 +1,72 @@
 #ifndef DEV_LCD_H
 #define DEV_LCD_H
 
+// Largest palette a driver may expose (4 bits per pixel)
+#define DISPLAY_PALETTE_MAX     16
+
+// Well-known palette slots, set from the root layout colors
+#define DISPLAY_PALETTE_BG      0
+#define DISPLAY_PALETTE_FG      1
+
+// Quarter turns of the picture on the panel, see set_rotation
+typedef enum {
+    DISPLAY_ROTATION_0 = 0,     // native orientation of the driver
+    DISPLAY_ROTATION_90,
+    DISPLAY_ROTATION_180,
+    DISPLAY_ROTATION_270,
+    DISPLAY_ROTATION_COUNT,
+} display_rotation_t;
+
 typedef struct {
     uint8_t* data;
     uint16_t size;
-    uint16_t fg_color;
-    uint16_t bg_color;
+    uint16_t width, height;                 // of the frames being rendered, rotation included
+    uint16_t stride;                        // bytes per row of a render page
+    bool column_scroll;                     // set_scroll can move columns at this rotation
+    uint8_t palette_size;                   // number of usable entries, 1 << bits per pixel
+    uint16_t palette[DISPLAY_PALETTE_MAX];  // RGB565, indexed by pixel value
 } display_info_t;
 
+// Produces pixels x0..x1 of row y from a page that holds no pixels (display list
+// mode), RGB565 as the driver sends it through `palette`, into out[0..x1 - x0]
+typedef void (*display_scanline_t)(uint8_t* page, uint16_t y, uint16_t x0, uint16_t x1,
+                                   const uint16_t* palette, uint16_t* out);
+
+// Scanout counters since init
+typedef struct {
+    uint32_t frames_sent;       // frames whose dirty rectangles went to the panel
+    uint32_t frames_skipped;    // rendered frames that changed nothing, not sent
+    uint32_t frames_throttled;  // frames held back by the frame rate limit
+    uint32_t refreshes;         // of frames_sent: the shown page again, after the refresh interval
+    uint32_t frames_dropped;    // rendered frames replaced by a newer one before scanout took them
+    uint32_t render_stalls;     // begin_frame calls that found no page to draw into
+    uint32_t band_changes;      // frames that entered, moved or left the band, or switched idle mode
+    uint32_t band_change_cycles; // CPU clock cycles the last of them took to send, commands and resent pixels included
+    uint32_t frame_cycles;      // CPU clock cycles the last other frame took to send
+} display_stats_t;
+
 typedef struct {
     void (*init)(void);
     // void (*update)(void);
-    // void (*update_window)(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void (*update_window)(uint16_t x, uint16_t y, uint16_t w, uint16_t h); // mark a region of the render page dirty
     display_info_t* (*get_framebuffer)(void);
+    void (*set_scanline_source)(display_scanline_t source); // display list mode only, may be NULL
+    // Hardware scroll for the frame being rendered: columns start..start + size - 1 are
+    // shown from `offset` on, wrapping; size 0 turns scrolling off
+    void (*set_scroll)(uint16_t start, uint16_t size, uint16_t offset);
+    // Active band for the frame being rendered: the panel only shows columns
+    // start..start + size - 1, size 0 is the whole screen; idle drops it to 8 colors
+    void (*set_band)(uint16_t start, uint16_t size, bool idle);
+    // Page handoff, neither call blocks. begin_frame returns the page to draw the next
+    // frame into, holding what the last finished frame showed, or NULL while scanout
+    // owns every page; end_frame hands the page to scanout.
+    uint8_t* (*begin_frame)(void);
+    void (*end_frame)(void);
+    // Rotation of the frames rendered from now on, called after begin_frame. width,
+    // height and stride of display_info_t follow at once; the panel turns when the
+    // first such frame is sent, all of it.
+    void (*set_rotation)(display_rotation_t rotation);
+    void (*get_stats)(display_stats_t* stats);
 } display_driver_t;
 
 #endif /* DEV_LCD_H */
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "dirty_region.h"
+
+static uint32_t rect_area(const dirty_rect_t* r) {
+    return (uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1);
+}
+
+// Overlapping or edge-adjacent rectangles are merged; adjacent text lines collapse into one block
+static bool rects_touch(const dirty_rect_t* a, const dirty_rect_t* b) {
+    return (a->x0 <= b->x1 + 1) && (b->x0 <= a->x1 + 1) &&
+           (a->y0 <= b->y1 + 1) && (b->y0 <= a->y1 + 1);
+}
+
+static dirty_rect_t rect_union(const dirty_rect_t* a, const dirty_rect_t* b) {
+    dirty_rect_t r;
+    r.x0 = (a->x0 < b->x0) ? a->x0 : b->x0;
+    r.y0 = (a->y0 < b->y0) ? a->y0 : b->y0;
+    r.x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    r.y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+    return r;
+}
+
+static void remove_rect(dirty_region_t* region, uint8_t index) {
+    region->count--;
+    region->rects[index] = region->rects[region->count];
+}
+
+void dirty_region_reset(dirty_region_t* region) {
+    region->count = 0;
+}
+
+void dirty_region_add(dirty_region_t* region, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    if (!region || x1 < x0 || y1 < y0) return;
+
+    dirty_rect_t rect = {x0, y0, x1, y1};
+
+    for (;;) {
+        bool merged = false;
+
+        // Absorb every rectangle the new one touches, restarting since the union grows
+        for (uint8_t i = 0; i < region->count; ++i) {
+            if (rects_touch(&rect, &region->rects[i])) {
+                rect = rect_union(&rect, &region->rects[i]);
+                remove_rect(region, i);
+                merged = true;
+                break;
+            }
+        }
+
+        if (merged) continue;
+
+        if (region->count < DIRTY_REGION_MAX_RECTS) {
+            region->rects[region->count++] = rect;
+            return;
+        }
+
+        // Table full: fold into the rectangle that grows the least, then retry
+        uint8_t best = 0;
+        uint32_t best_cost = UINT32_MAX;
+        for (uint8_t i = 0; i < region->count; ++i) {
+            dirty_rect_t u = rect_union(&rect, &region->rects[i]);
+            uint32_t cost = rect_area(&u) - rect_area(&region->rects[i]);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best = i;
+            }
+        }
+        rect = rect_union(&rect, &region->rects[best]);
+        remove_rect(region, best);
+    }
+}
+
+bool dirty_region_is_empty(const dirty_region_t* region) {
+    return region->count == 0;
+}
@@ -0,0 +1,25 @@
+#ifndef DIRTY_REGION_H
+#define DIRTY_REGION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Maximum number of disjoint rectangles tracked per framebuffer page
+#define DIRTY_REGION_MAX_RECTS  8
+
+// Rectangle in panel coordinates, both corners inclusive (same as CASET/PASET)
+typedef struct {
+    uint16_t x0, y0;
+    uint16_t x1, y1;
+} dirty_rect_t;
+
+typedef struct {
+    uint8_t count;
+    dirty_rect_t rects[DIRTY_REGION_MAX_RECTS];
+} dirty_region_t;
+
+void dirty_region_reset(dirty_region_t* region);
+void dirty_region_add(dirty_region_t* region, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+bool dirty_region_is_empty(const dirty_region_t* region);
+
+#endif /* DIRTY_REGION_H */
@@ -74,4 +74,8 @@ void display_task(void *param) {
 
 uint16_t get_display_data_bank_index(void) {
     return databank_index;
+}
+
+const display_driver_t* get_display_driver(void) {
+    return display_interface.driver;
 }
\ No newline at end of file
@@ -19,5 +19,6 @@ typedef struct {
 void display_init(void);
 void display_task(void *param);
 uint16_t get_display_data_bank_index(void);
+const display_driver_t* get_display_driver(void);
 
 #endif /* DISPLAY_INTERFACE_H */
\ No newline at end of file